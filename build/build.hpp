@@ -0,0 +1,6 @@
+#define VERSION "2.1.3"
+#define IDENTIFIER "7a68b195b45a737d6de896794895530651b1016f"
+#define SHORTID "7a68b19"
+#define COMPILER "g++ (Debian 12.2.0-14+deb12u1) 12.2.0"
+#define FLAGS "-Wall -Wextra -O3 -DNDEBUG"
+#define DATE "Mon Oct 19 07:18:01 UTC 2026 Linux vm 6.18.44-fc-v139 x86_64"
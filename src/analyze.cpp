@@ -60,7 +60,7 @@ void Internal::bump_queue (int lit) {
   btab[idx] = ++stats.bumped;
   LOG ("moved to front variable %d and bumped to %" PRId64 "", idx,
        btab[idx]);
-  if (!vals[idx])
+  if (!val (idx))
     update_queue_unassigned (idx);
 }
 
@@ -255,7 +255,7 @@ inline void Internal::analyze_literal (int lit, int &open,
                                        int &resolvent_size,
                                        int &antecedent_size) {
   assert (lit);
-  Var &v = var (lit);
+  VarRef v = var (lit);
   Flags &f = flags (lit);
 
   if (!v.level) {
@@ -348,7 +348,7 @@ inline bool Internal::bump_also_reason_literal (int lit) {
   Flags &f = flags (lit);
   if (f.seen)
     return false;
-  const Var &v = var (lit);
+  VarRef v = var (lit);
   if (!v.level)
     return false;
   f.seen = true;
@@ -362,7 +362,7 @@ inline bool Internal::bump_also_reason_literal (int lit) {
 inline void Internal::bump_also_reason_literals (int lit, int limit) {
   assert (lit);
   assert (limit > 0);
-  const Var &v = var (lit);
+  VarRef v = var (lit);
   assert (val (lit));
   if (!v.level)
     return;
@@ -444,7 +444,7 @@ struct analyze_trail_negative_rank {
   analyze_trail_negative_rank (Internal *s) : internal (s) {}
   typedef uint64_t Type;
   Type operator() (int a) {
-    Var &v = internal->var (a);
+    VarRef v = internal->var (a);
     uint64_t res = v.level;
     res <<= 32;
     res |= v.trail;
@@ -590,7 +590,7 @@ inline int Internal::find_conflict_level (int &forced) {
 
     if (highest_position > 1) {
       LOG (conflict, "unwatch %d in", lit);
-      remove_watch (watches (lit), conflict);
+      remove_watch (watches (lit), clause_ref (conflict));
     }
 
     lits[highest_position] = lit;
@@ -766,8 +766,8 @@ Clause *Internal::on_the_fly_strengthen (Clause *new_conflict, int uip) {
   LOG (new_conflict, "putting uip at pos 1");
 
   if (other_init != other)
-    remove_watch (watches (other_init), new_conflict);
-  remove_watch (watches (uip), new_conflict);
+    remove_watch (watches (other_init), clause_ref (new_conflict));
+  remove_watch (watches (uip), clause_ref (new_conflict));
 
   assert (!lrat || lrat_chain.back () == new_conflict->id);
   if (lrat) {
@@ -819,7 +819,8 @@ Clause *Internal::on_the_fly_strengthen (Clause *new_conflict, int uip) {
   if (other_init != other)
     watch_literal (other, lits[1], new_conflict);
   else {
-    update_watch_size (watches (other), lits[1], new_conflict);
+    update_watch_size (watches (other), lits[1], clause_ref (new_conflict),
+                       new_conflict->size);
   }
   watch_literal (lits[1], other, new_conflict);
 
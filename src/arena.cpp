@@ -1,29 +1,120 @@
 #include "internal.hpp"
 
+#ifdef WATCH32
+#include <sys/mman.h>
+#endif
+
 namespace CaDiCaL {
 
-Arena::Arena (Internal *i) {
-  memset (this, 0, sizeof *this);
-  internal = i;
+Arena::Arena (Internal *i) : internal (i) {
+  from.start = from.top = from.end = 0;
+  to.start = to.top = to.end = 0;
+#ifdef WATCH32
+  compacted_top = 0;
+#endif
 }
 
 Arena::~Arena () {
+#ifndef WATCH32
   delete[] from.start;
+  for (const auto &chunk : nursery)
+    delete[] chunk.start;
+#else
+  if (from.start)
+    munmap (from.start, from.end - from.start);
+#endif
   delete[] to.start;
 }
 
+#ifndef WATCH32
+
+// Nursery chunks double in size, starting with one megabyte.
+
+void Arena::grow_nursery (size_t bytes) {
+  size_t size = (size_t) 1 << 20;
+  if (!nursery.empty ())
+    size = 2 * (size_t) (nursery.back ().end - nursery.back ().start);
+  size = max (size, bytes);
+  Space chunk;
+  chunk.start = chunk.top = new char[size];
+  chunk.end = chunk.start + size;
+  internal->huge_pages (chunk.start, size);
+  nursery.push_back (chunk);
+  LOG ("new nursery chunk of %zd bytes", size);
+}
+
+void Arena::reset_nursery () {
+  if (nursery.empty ())
+    return;
+  Space last = nursery.back ();
+  nursery.pop_back ();
+  for (const auto &chunk : nursery)
+    delete[] chunk.start;
+  nursery.clear ();
+  last.top = last.start;
+  nursery.push_back (last);
+  LOG ("reset nursery keeping %zd bytes", (size_t) (last.end - last.start));
+}
+
+#else
+
+// Reserves the largest range of virtual memory which can still be
+// addressed by 31 bit references to 8 byte aligned clauses (or less if
+// that fails), without actually committing physical memory for it.
+
+void Arena::reserve () {
+  if (from.start)
+    FATAL ("clause arena of %zu bytes exhausted",
+           (size_t) (from.end - from.start));
+  size_t bytes = (size_t) 1 << 34;
+  const int prot = PROT_READ | PROT_WRITE;
+  const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+  void *p = MAP_FAILED;
+  while (bytes >= ((size_t) 1 << 26) &&
+         (p = mmap (0, bytes, prot, flags, -1, 0)) == MAP_FAILED)
+    bytes /= 2;
+  if (p == MAP_FAILED)
+    FATAL ("could not reserve memory for clause arena");
+  LOG ("reserved clause arena of %zu bytes", bytes);
+  from.start = from.top = compacted_top = (char *) p;
+  from.end = from.start + bytes;
+  internal->huge_pages (from.start, bytes);
+}
+
+#endif
+
 void Arena::prepare (size_t bytes) {
   LOG ("preparing 'to' space of arena with %zd bytes", bytes);
   assert (!to.start);
   to.top = to.start = new char[bytes];
   to.end = to.start + bytes;
+  internal->huge_pages (to.start, bytes);
 }
 
 void Arena::swap () {
+#ifndef WATCH32
   delete[] from.start;
   LOG ("delete 'from' space of arena with %zd bytes",
        (size_t) (from.end - from.start));
   from = to;
+  reset_nursery ();
+#else
+  // Move the copied clauses back to their final place at the bottom of
+  // the 'from' space and give the pages above back to the system.
+  //
+  const size_t bytes = to.top - to.start;
+  assert (!from.start || from.start + bytes <= from.top);
+  if (bytes)
+    memcpy (from.start, to.start, bytes);
+  char *old_top = from.top;
+  from.top = compacted_top = from.start + bytes;
+  const size_t page = getpagesize ();
+  char *begin = from.start + align (bytes, page);
+  if (begin < old_top)
+    madvise (begin, old_top - begin, MADV_DONTNEED);
+  LOG ("moved %zd bytes back to 'from' space of arena", bytes);
+  delete[] to.start;
+#endif
   to.start = to.top = to.end = 0;
 }
 
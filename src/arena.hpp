@@ -50,16 +50,49 @@ namespace CaDiCaL {
 //   ...
 //
 // One has to be really careful with 'qi' references to arena memory.
-
+// With 'opts.arenaincr' the 'copy' calls between 'prepare' and 'swap' are
+// spread over many conflicts (see 'move_clauses' in 'collect.cpp').
+
+// Unless compiled with '-DWATCH32' new clauses can also be allocated in the
+// 'nursery' of the arena (see 'allocate' and 'opts.nursery') instead of
+// separately with 'new', which avoids calling 'malloc' and 'free' for each
+// learned clause.  Nursery memory is never freed individually.  Garbage
+// collection copies (promotes) all surviving clauses to 'to' space anyhow,
+// and thus 'swap' can reset the whole nursery at once.  Its last and thus
+// largest chunk is kept for allocating new clauses afterwards.
+
+// With '-DWATCH32' all clauses are allocated in the arena (see 'allocate')
+// and watches refer to them by 32-bit offsets (see 'watch.hpp').  Then the
+// 'from' space is a large reserved range of virtual memory which never
+// moves, and new clauses are allocated at its top.  The 'to' space is only
+// a temporary buffer during garbage collection.  The addresses returned
+// by 'copy' are already the final ones in 'from' space, to which the
+// copied clauses are moved back by 'swap'.  Until then only the original
+// clauses can be accessed (which have the same size and literals).
+
+struct Clause;
 struct Internal;
 
 class Arena {
 
   Internal *internal;
 
-  struct {
+  struct Space {
     char *start, *top, *end;
-  } from, to;
+  };
+
+  Space from, to;
+
+#ifndef WATCH32
+  std::vector<Space> nursery; // chunks with new clauses
+  void grow_nursery (size_t bytes);
+  void reset_nursery ();
+#endif
+
+#ifdef WATCH32
+  char *compacted_top; // end of clauses kept by the last 'swap'
+  void reserve ();
+#endif
 
 public:
   Arena (Internal *);
@@ -72,14 +105,79 @@ public:
   void prepare (size_t bytes);
 
   // Does the memory pointed to by 'p' belong to this arena? More precisely
-  // to the 'from' space, since that is the only one remaining after 'swap'.
+  // to the 'from' space (or the nursery), since that is the only one
+  // remaining after 'swap'.
   //
   bool contains (void *p) const {
     char *c = (char *) p;
-    return (from.start <= c && c < from.top) ||
-           (to.start <= c && c < to.top);
+    if ((from.start <= c && c < from.top) || (to.start <= c && c < to.top))
+      return true;
+#ifndef WATCH32
+    for (const auto &chunk : nursery)
+      if (chunk.start <= c && c < chunk.top)
+        return true;
+#endif
+    return false;
+  }
+
+  // Has the memory pointed to by 'p' been kept in 'from' space by the last
+  // garbage collection (as opposed to allocated afterwards)?
+  //
+  bool compacted (void *p) const {
+    char *c = (char *) p;
+#ifndef WATCH32
+    return from.start <= c && c < from.top;
+#else
+    return from.start <= c && c < compacted_top;
+#endif
+  }
+
+#ifndef WATCH32
+
+  // Allocate that amount of memory (a multiple of 8 bytes) in the nursery.
+  //
+  char *allocate (size_t bytes) {
+    assert (!(bytes & 7));
+    if (nursery.empty () ||
+        (size_t) (nursery.back ().end - nursery.back ().top) < bytes)
+      grow_nursery (bytes);
+    Space &chunk = nursery.back ();
+    char *res = chunk.top;
+    chunk.top += bytes;
+    assert (chunk.top <= chunk.end);
+    return res;
+  }
+
+#else
+
+  // Allocate that amount of memory (a multiple of 8 bytes) at the top of
+  // the 'from' space, which is reserved on first use.
+  //
+  char *allocate (size_t bytes) {
+    assert (!(bytes & 7));
+    if ((size_t) (from.end - from.top) < bytes)
+      reserve ();
+    char *res = from.top;
+    from.top += bytes;
+    assert (from.top <= from.end);
+    return res;
   }
 
+  // Map clauses to their offsets in 8 byte units and back.
+  //
+  unsigned ref (const Clause *c) const {
+    const char *p = (const char *) c;
+    assert (from.start <= p && p < from.end);
+    assert (!((p - from.start) & 7));
+    return (p - from.start) >> 3;
+  }
+
+  Clause *clause (unsigned ref) const {
+    return (Clause *) (from.start + ((size_t) ref << 3));
+  }
+
+#endif
+
   // Allocate that amount of memory in 'to' space.  This assumes the 'to'
   // space has been prepared to hold enough memory with 'prepare'.  Then
   // copy the memory pointed to by 'p' of size 'bytes'.  Note that it does
@@ -90,6 +188,9 @@ public:
     to.top += bytes;
     assert (to.top <= to.end);
     memcpy (res, p, bytes);
+#ifdef WATCH32
+    res = from.start + (res - to.start);
+#endif
     return res;
   }
 
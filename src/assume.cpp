@@ -34,7 +34,7 @@ void Internal::assume_analyze_literal (int lit) {
     return;
   f.seen = true;
   analyzed.push_back (lit);
-  Var &v = var (lit);
+  VarRef v = var (lit);
   assert (val (lit) < 0);
   if (v.reason == external_reason) {
     v.reason = wrapped_learn_external_reason_clause (-lit);
@@ -111,7 +111,7 @@ void Internal::failing () {
         lit = -lit;
       if (val (lit) >= 0)
         continue;
-      const Var &v = var (lit);
+      VarRef v = var (lit);
       if (!v.level) {
         failed_unit = lit;
         efailed = elit;
@@ -120,7 +120,7 @@ void Internal::failing () {
       if (failed_clashing)
         continue;
       if (v.reason == external_reason) {
-        Var &ev = var (lit);
+        VarRef ev = var (lit);
         ev.reason = learn_external_reason_clause (-lit);
         if (!ev.reason) {
           ev.level = 0;
@@ -277,7 +277,7 @@ void Internal::failing () {
       while (next < analyzed.size ()) {
         const int lit = analyzed[next++];
         assert (val (lit) > 0);
-        Var &v = var (lit);
+        VarRef v = var (lit);
         if (!v.level)
           continue;
         if (v.reason == external_reason) {
@@ -313,7 +313,7 @@ void Internal::failing () {
     } else if (!unsat_constraint) { // LRAT for case (3)
       assert (clause.size () == 1);
       const int lit = clause[0];
-      Var &v = var (lit);
+      VarRef v = var (lit);
       assert (v.reason);
       if (v.reason == external_reason) { // does this even happen?
         v.reason = wrapped_learn_external_reason_clause (lit);
@@ -534,7 +534,7 @@ struct sort_assumptions_positive_rank {
   Type operator() (const int &a) const {
     const int val = internal->val (a);
     const bool assigned = (val != 0);
-    const Var &v = internal->var (a);
+    VarRef v = internal->var (a);
     uint64_t res = (assigned ? (unsigned) v.level : max_level);
     res <<= 32;
     res |= (assigned ? v.trail : abs (a));
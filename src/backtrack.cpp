@@ -27,6 +27,16 @@ inline void Internal::unassign (int lit) {
   //
   if (queue.bumped < btab[idx])
     update_queue_unassigned (idx);
+
+  // Similarly prioritized observed variables are searched for unassigned
+  // ones starting at 'priority_unassigned' (see 'decide').  Without such
+  // priorities we avoid touching 'priotab' on every unassignment.
+  //
+  if (priorities.empty ())
+    return;
+  const unsigned pos = priotab[idx];
+  if (pos && pos <= priority_unassigned)
+    priority_unassigned = pos - 1;
 }
 
 /*------------------------------------------------------------------------*/
@@ -108,7 +118,7 @@ void Internal::backtrack (int new_level) {
 
   while (i < end_of_trail) {
     int lit = trail[i++];
-    Var &v = var (lit);
+    VarRef v = var (lit);
     if (v.level > new_level) {
       unassign (lit);
 #ifdef LOGGING
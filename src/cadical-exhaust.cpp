@@ -13,6 +13,8 @@
 #include <algorithm>
 
 #include "exhaustive.hpp"
+#include "graph.hpp"
+#include "symmetry.hpp"
 
 /*------------------------------------------------------------------------*/
 
@@ -124,6 +126,11 @@ void App::print_usage (bool all) {
             "  --order <n>    only do an exhaustive search over vars 1 to n\n"
             "  --only-neg     only use negative literals in exhaustive blocking clauses\n"
             "  --solfile <f>  write solutions to file f, not on the standard output\n"
+            "  --canonical <k> only enumerate canonical graphs on k vertices\n"
+            "  --unembeddable <k> block minimal unembeddable subgraphs\n"
+            "  --async        check canonicity on a helper thread\n"
+            "  --symmetry     break static symmetries of the projection\n"
+            "  --prioritize   decide the exhaustive search variables first\n"
     );
   } else { // Print complete list of all options.
     printf (
@@ -143,6 +150,17 @@ void App::print_usage (bool all) {
         "  --order <n>    only do an exhaustive search over vars 1 to n\n"
         "  --only-neg     only use negative literals in exhaustive blocking clauses\n"
         "  --solfile <f>  write solutions to file f, not on the standard output\n"
+        "  --canonical <k> only enumerate canonical graphs on k vertices\n"
+        "                 (vars 1 to k(k-1)/2 are the upper-triangular\n"
+        "                 adjacency matrix ordered column by column)\n"
+        "  --async        check canonicity of partial assignments\n"
+        "                 asynchronously on a helper thread\n"
+        "  --unembeddable <k> block graphs on k vertices containing one of\n"
+        "                 the minimal unembeddable subgraphs\n"
+        "  --symmetry     detect symmetries of the formula and add lex-leader\n"
+        "                 constraints over the exhaustive search variables\n"
+        "  --prioritize   decide the exhaustive search variables first and\n"
+        "                 in order before all other variables\n"
         "\n"
         "Or '<option>' is one of the less common options\n"
         "\n"
@@ -355,6 +373,12 @@ int App::main (int argc, char **argv) {
   bool only_neg = false;
   FILE * solfile = NULL;
   bool can_forget = false;
+  int vertices = 0;
+  bool canonical = false;
+  bool unembeddable = false;
+  bool symmetry = false;
+  bool async = false;
+  bool prioritize = false;
 
   // Handle options which lead to immediate exit first.
 
@@ -526,6 +550,26 @@ int App::main (int argc, char **argv) {
         order = stoi(argv[i]);
         std::cout << "c order = " << order << endl;
       }
+    } else if (!strcmp (argv[i], "--canonical") ||
+               !strcmp (argv[i], "--unembeddable")) {
+      const char *option = argv[i];
+      int tmp = 0;
+      if (++i == argc)
+        APPERR ("argument to '%s' missing", option);
+      else if (!parse_int_str (argv[i], tmp))
+        APPERR ("invalid argument in '%s %s'", option, argv[i]);
+      else if (tmp < 2)
+        APPERR ("invalid number of vertices");
+      else if (vertices && vertices != tmp)
+        APPERR ("inconsistent number of vertices '%d' and '%s %s'", vertices, option, argv[i]);
+      else {
+        vertices = tmp;
+        if (!strcmp (option, "--canonical"))
+          canonical = true;
+        else
+          unembeddable = true;
+        std::cout << "c " << option + 2 << " = " << vertices << endl;
+      }
     } else if (!strcmp (argv[i], "--solfile")) {
       if (++i == argc)
         APPERR ("argument to '--solfile' missing");
@@ -541,6 +585,18 @@ int App::main (int argc, char **argv) {
       only_neg = true;
       std::cout << "c only-neg = true" << endl;
     }
+    else if (!strcmp (argv[i], "--symmetry")) {
+      symmetry = true;
+      std::cout << "c symmetry = true" << endl;
+    }
+    else if (!strcmp (argv[i], "--async")) {
+      async = true;
+      std::cout << "c async = true" << endl;
+    }
+    else if (!strcmp (argv[i], "--prioritize")) {
+      prioritize = true;
+      std::cout << "c prioritize = true" << endl;
+    }
     else if (!strcmp (argv[i], "--can-forget")) {
       can_forget = true;
       std::cout << "c can-forget = true" << endl;
@@ -909,12 +965,43 @@ int App::main (int argc, char **argv) {
   } else {
     solver->section ("solving");
 
-    ExhaustiveSearch se(solver, order, only_neg, solfile, can_forget);
+    if (vertices) {
+      if (order && order != vertices * (vertices - 1) / 2)
+        APPERR ("'--order %d' does not match graphs on %d vertices", order, vertices);
+      if (solver->vars () < vertices * (vertices - 1) / 2)
+        APPERR ("graphs on %d vertices need %d variables", vertices, vertices * (vertices - 1) / 2);
+    }
+    if (async && !canonical)
+      APPERR ("'--async' requires '--canonical <k>'");
+    if (symmetry && canonical)
+      APPERR ("'--symmetry' can not be combined with '--canonical <k>'");
+
+    if (symmetry) {
+      // The projection has to be fixed before auxiliary variables are added.
+      if (!order)
+        order = vertices ? vertices * (vertices - 1) / 2 : solver->vars ();
+      StaticSymmetry ss (solver, order);
+      ss.detect ();
+      ss.add_symmetry_breaking ();
+    }
+
+    if (vertices) {
+      GraphSearch gs(solver, vertices, canonical, unembeddable, only_neg, solfile, can_forget, async);
+      if (prioritize)
+        gs.prioritize ();
 
-    max_var = solver->active ();
-    //std::cout << "c Nof vars: " << max_var << std::endl;
+      max_var = solver->active ();
+      res = solver->solve ();
+    } else {
+      ExhaustiveSearch se(solver, order, only_neg, solfile, can_forget);
+      if (prioritize)
+        se.prioritize ();
 
-    res = solver->solve ();
+      max_var = solver->active ();
+      //std::cout << "c Nof vars: " << max_var << std::endl;
+
+      res = solver->solve ();
+    }
   }
 
   if (solver->proof_specified) {
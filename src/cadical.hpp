@@ -229,6 +229,11 @@ public:
   ~Solver ();
   bool proof_specified = false;
 
+  // Announce that the given clause is trusted, e.g., a blocking clause of
+  // an exhaustive search, which is added right afterwards.  It is written
+  // as 't' line to DRAT proofs and accepted without check by the internal
+  // proof checker ('--checkproof').
+  //
   void add_trusted_clause(const std::vector<int> & clause);
 
   static const char *signature (); // name of this library
@@ -419,6 +424,18 @@ public:
   //
   void reset_observed_vars ();
 
+  // Observed variables can be given a decision priority order, which lets
+  // the solver decide them before all other variables in that order (with
+  // their saved phases) instead of asking 'cb_decide' of the propagator.
+  // Further calls, which are also allowed during solving, append to the
+  // order.  Variables which are not observed are ignored.  The order is
+  // reset with the observed variables.
+  //
+  //   require (VALID_OR_SOLVING)
+  //   ensure (VALID_OR_SOLVING)
+  //
+  void prioritize_observed_vars (const std::vector<int> &vars);
+
   // Get reason of valid observed literal (true = it is an observed variable
   // and it got assigned by a decision during the CDCL loop. Otherwise:
   // false.
@@ -1161,6 +1178,22 @@ public:
 
 /*------------------------------------------------------------------------*/
 
+// Read-only view of the assigned observed variables in assignment order,
+// which is passed to propagators derived from 'TrailViewPropagator' (see
+// below).  Every variable occurs at most once.  The literals of the root
+// level are 'lits[0]' up to (excluding) 'lits[levels[0]]', those of
+// decision level 'l' (with '0 < l < level') start at 'levels[l-1]' and end
+// at 'levels[l]', and the last level ends at 'size'.
+
+struct ExternalTrail {
+  const int *lits;      // assigned observed literals
+  size_t size;          // number of literals in 'lits'
+  const size_t *levels; // end of the literals of each level in 'lits'
+  size_t level;         // current decision level
+};
+
+/*------------------------------------------------------------------------*/
+
 // Allows to connect an external propagator to propagate values to variables
 // with an external clause as a reason or to learn new clauses during the
 // CDCL loop (without restart).
@@ -1171,6 +1204,8 @@ public:
   bool is_lazy = false; // lazy propagator only checks complete assignments
   bool are_reasons_forgettable =
       false; // Reason external clauses can be deleted
+  bool uses_trail_view = false; // set by 'TrailViewPropagator'
+  size_t observed_threshold = 0; // sleep below assigned observed vars
 
   virtual ~ExternalPropagator () {}
 
@@ -1179,11 +1214,36 @@ public:
   // the call of propagator callbacks and when a driving clause is leading
   // to an assignment.
   //
-  // virtual void notify_assignment (int lit, bool is_fixed) = 0;
   virtual void notify_assignment (const std::vector<int> &lits) = 0;
   virtual void notify_new_decision_level () = 0;
   virtual void notify_backtrack (size_t new_level) = 0;
 
+  // Alternative notification interface for propagators derived from
+  // 'TrailViewPropagator' (see below).  Instead of copying the new
+  // assignments into a vector and calling 'notify_assignment' and
+  // 'notify_new_decision_level' for every event, the solver maintains the
+  // observed part of the trail itself and only calls 'notify_trail' with a
+  // view into it when there are new assignments (the literals starting at
+  // position 'from' are new).  The referenced view stays valid while the
+  // propagator is connected and is up-to-date during all later callbacks.
+  // In particular 'notify_backtrack' is called before the literals of the
+  // backtracked levels are removed, i.e., these are the literals from
+  // 'trail.levels[new_level]' up to 'trail.size'.
+  //
+  // Propagators using the trail view can further set 'observed_threshold'
+  // before being connected, which lets them sleep while less than that
+  // many observed variables are assigned (setting it to the number of
+  // observed variables wakes them only on complete assignments of those).
+  // While asleep, neither 'notify_trail' nor 'cb_propagate', 'cb_decide'
+  // and 'cb_has_external_clause' are called, and 'notify_backtrack' is only
+  // called if notified literals are backtracked.  The view then only
+  // contains the notified literals, thus 'trail.levels' might point beyond
+  // 'trail.size' for levels which were not notified yet.
+  //
+  virtual void notify_trail (const ExternalTrail &trail, size_t from) {
+    (void) trail, (void) from;
+  }
+
   // Check by the external propagator the found complete solution (after
   // solution reconstruction). If it returns false, the propagator should
   // provide an external clause during the next callback or introduce new
@@ -1203,6 +1263,20 @@ public:
   //
   virtual int cb_propagate () { return 0; };
 
+  // Optional batched alternative to 'cb_propagate', which is tried first.
+  // If the propagator returns true, 'lits' points to 'size' literals to be
+  // propagated (where 'size == 0' means there are none), which have to stay
+  // valid until the next callback.  All of them are assigned before unit
+  // propagation runs, thus their reasons (asked for lazily as for
+  // 'cb_propagate') may only contain literals assigned before the call.  If
+  // one of them is falsified, its reason is learned and the rest of the
+  // batch is dropped.
+  //
+  virtual bool cb_propagate_batch (const int *&lits, size_t &size) {
+    (void) lits, (void) size;
+    return false;
+  }
+
   // Ask the external propagator for the reason clause of a previous
   // external propagation step (done by cb_propagate). The clause must be
   // added literal-by-literal closed with a 0. Further, the clause must
@@ -1216,6 +1290,18 @@ public:
     return 0;
   };
 
+  // Optional whole-clause alternative to 'cb_add_reason_clause_lit'. If
+  // the propagator returns true, 'lits' points to the 'size' literals of
+  // the reason clause (without closing 0), which have to stay valid until
+  // the next callback.  Otherwise (the default) the clause is read with
+  // 'cb_add_reason_clause_lit'.
+  //
+  virtual bool cb_add_reason_clause (int propagated_lit, const int *&lits,
+                                     size_t &size) {
+    (void) propagated_lit, (void) lits, (void) size;
+    return false;
+  }
+
   // The following two functions are used to add external clauses to the
   // solver during the CDCL loop. The external clause is added
   // literal-by-literal and learned by the solver as an irredundant
@@ -1260,6 +1346,89 @@ public:
   // The actual function called to add the external clause.
   //
   virtual int cb_add_external_clause_lit () = 0;
+
+  // Optional whole-clause alternative to 'cb_add_external_clause_lit',
+  // which is tried first.  If the propagator returns true, 'lits' points
+  // to the 'size' literals of the external clause (without closing 0),
+  // which have to stay valid until the next callback.  This avoids one
+  // virtual call per literal for long (e.g., blocking) clauses.
+  //
+  virtual bool cb_add_external_clause (const int *&lits, size_t &size) {
+    (void) lits, (void) size;
+    return false;
+  }
+};
+
+// Base class of external propagators which are notified through the trail
+// view with 'notify_trail' (and 'notify_backtrack') instead of the classic
+// 'notify_assignment' and 'notify_new_decision_level', which are never
+// called for them.  Deriving from 'ExternalPropagator' directly keeps the
+// classic notifications mandatory.
+
+class TrailViewPropagator : public ExternalPropagator {
+public:
+  TrailViewPropagator () { uses_trail_view = true; }
+
+  void notify_assignment (const std::vector<int> &) override {}
+  void notify_new_decision_level () override {}
+  virtual void notify_trail (const ExternalTrail &trail,
+                             size_t from) override = 0;
+};
+
+/*------------------------------------------------------------------------*/
+
+// Mirror of the assigned observed variables for external propagators using
+// the classic notification interface, which is fed by forwarding the
+// notifications, e.g.,
+//
+//   void notify_assignment (const std::vector<int> &lits) override {
+//     mirror.assign (lits);
+//   }
+//   void notify_new_decision_level () override { mirror.new_level (); }
+//   void notify_backtrack (size_t new_level) override {
+//     mirror.backtrack (new_level);
+//   }
+//
+// The literals are kept in one flat array in assignment order and the
+// decision levels are given by offsets into it in the same way as in
+// 'ExternalTrail'.  Values are looked up in constant time.  Literals of
+// already assigned variables are ignored, thus repeatedly notified
+// root-level assignments only occur once.
+
+class TrailMirror {
+  std::vector<int> lits;           // assigned literals in order
+  std::vector<size_t> ends;        // end of each level in 'lits'
+  std::vector<signed char> values; // value of variables
+
+public:
+  void assign (int lit);
+  void assign (const std::vector<int> &lits);
+  void new_level ();
+  void backtrack (size_t new_level);
+  void clear ();
+
+  // Returns '1' if 'lit' is true, '-1' if it is false and '0' otherwise.
+  //
+  int value (int lit) const {
+    const size_t idx = lit < 0 ? -lit : lit;
+    const int res = idx < values.size () ? values[idx] : 0;
+    return lit < 0 ? -res : res;
+  }
+
+  size_t size () const { return lits.size (); }
+  size_t level () const { return ends.size (); }
+
+  // The literals of decision level 'l' are 'lits[begin (l)]' up to
+  // (excluding) 'lits[end (l)]'.
+  //
+  size_t begin (size_t l) const { return l ? ends[l - 1] : 0; }
+  size_t end (size_t l) const {
+    return l < ends.size () ? ends[l] : size ();
+  }
+
+  int operator[] (size_t i) const { return lits[i]; }
+  std::vector<int>::const_iterator begin () const { return lits.begin (); }
+  std::vector<int>::const_iterator end () const { return lits.end (); }
 };
 
 /*------------------------------------------------------------------------*/
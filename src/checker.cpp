@@ -518,6 +518,15 @@ void Checker::add_original_clause (uint64_t id, bool, const vector<int> &c,
   STOP (checking);
 }
 
+void Checker::add_trusted_original_clause (uint64_t id,
+                                           const vector<int> &c) {
+  if (inconsistent)
+    return;
+  LOG (c, "CHECKER original clause is trusted");
+  stats.trusted++;
+  add_original_clause (id, false, c);
+}
+
 void Checker::add_derived_clause (uint64_t id, bool, const vector<int> &c,
                                   const vector<uint64_t> &) {
   if (inconsistent)
@@ -24,6 +24,13 @@ namespace CaDiCaL {
 // In our experiments the checker slows down overall SAT solving time by a
 // factor of 3, which we contribute to its slightly less efficient
 // implementation.
+//
+// Trusted clauses (like the blocking clauses of the exhaustive search and
+// the 't' lines in DRAT proofs) are announced before they are added as
+// original clauses.  The proof matches them and passes the original clause
+// through 'add_trusted_original_clause', which is then counted as trusted.
+// Thus the checker validates all derived clauses of an exhaustive search
+// online without the need to write a proof and check it with DRAT-trim-t.
 
 /*------------------------------------------------------------------------*/
 
@@ -128,6 +135,7 @@ class Checker : public StatTracer {
     int64_t added;    // number of added clauses
     int64_t original; // number of added original clauses
     int64_t derived;  // number of added derived clauses
+    int64_t trusted;  // number of added original trusted clauses
 
     int64_t deleted; // number of deleted clauses
 
@@ -155,6 +163,7 @@ public:
                             bool = false) override;
   void add_derived_clause (uint64_t, bool, const vector<int> &,
                            const vector<uint64_t> &) override;
+  void add_trusted_original_clause (uint64_t, const vector<int> &) override;
   void delete_clause (uint64_t, bool, const vector<int> &) override;
 
   void finalize_clause (uint64_t, const vector<int> &) override {} // skip
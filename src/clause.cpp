@@ -81,6 +81,10 @@ Clause *Internal::new_clause (bool red, int glue) {
 
   if (glue > size)
     glue = size;
+#ifdef COMPACTHEADER
+  if (glue > (int) Clause::max_glue)
+    glue = Clause::max_glue;
+#endif
 
   // Determine whether this clauses should be kept all the time.
   //
@@ -93,8 +97,18 @@ Clause *Internal::new_clause (bool red, int glue) {
     keep = false;
 
   size_t bytes = Clause::bytes (size);
-  Clause *c = (Clause *) new char[bytes];
-  DeferDeleteArray<char> clause_delete ((char *) c);
+#ifndef WATCH32
+  // Clauses in the nursery are only reclaimed by a moving garbage
+  // collection, which does not happen without 'opts.arena'.  While
+  // clauses are moved incrementally the nursery is not used either, since
+  // it is reset when moving completes.
+  const bool nursery = opts.nursery && opts.arena && !moving_end;
+  char *p = nursery ? arena.allocate (bytes) : new char[bytes];
+  Clause *c = (Clause *) p;
+  DeferDeleteArray<char> clause_delete (nursery ? 0 : p);
+#else
+  Clause *c = (Clause *) arena.allocate (bytes);
+#endif
 
   c->id = ++clause_id;
 
@@ -118,7 +132,7 @@ Clause *Internal::new_clause (bool red, int glue) {
 
   c->glue = glue;
   c->size = size;
-  c->pos = 2;
+  c->save_pos (2);
 
   for (int i = 0; i < size; i++)
     c->literals[i] = clause[i];
@@ -141,7 +155,9 @@ Clause *Internal::new_clause (bool red, int glue) {
   }
 
   clauses.push_back (c);
+#ifndef WATCH32
   clause_delete.release ();
+#endif
   LOG (c, "new pointer %p", (void *) c);
 
   if (likely_to_be_kept_clause (c))
@@ -201,16 +217,18 @@ size_t Internal::shrink_clause (Clause *c, int new_size) {
     c->literals[i] = 0;
 #endif
 
-  if (c->pos >= new_size)
-    c->pos = 2;
+  int pos = c->saved_pos ();
+  if (pos >= new_size)
+    pos = 2;
 
   size_t old_bytes = c->bytes ();
   c->size = new_size;
+  c->save_pos (pos);
   size_t new_bytes = c->bytes ();
   size_t res = old_bytes - new_bytes;
 
   if (c->redundant)
-    promote_clause (c, min (c->size - 1, c->glue));
+    promote_clause (c, min (c->size - 1, (int) c->glue));
   else {
     int delta_size = old_size - new_size;
     assert (stats.irrlits >= delta_size);
@@ -327,9 +345,9 @@ void Internal::assign_original_unit (uint64_t id, int lit) {
   assert (!level || opts.chrono);
   assert (!unsat);
   const int idx = vidx (lit);
-  assert (!vals[idx]);
+  assert (!val (idx));
   assert (!flags (idx).eliminated ());
-  Var &v = var (idx);
+  VarRef v = var (idx);
   v.level = 0;
   v.trail = (int) trail.size ();
   v.reason = 0;
@@ -476,7 +494,7 @@ void Internal::add_new_original_clause (uint64_t id) {
         const int idx = vidx (clause[0]);
         assert (val (clause[0]) >= 0);
         assert (!flags (idx).eliminated ());
-        Var &v = var (idx);
+        VarRef v = var (idx);
         assert (val (clause[0]));
         v.level = 0;
         v.reason = 0;
@@ -22,6 +22,15 @@ typedef const int *const_literal_iterator;
 // memory but more importantly also requires another memory access and thus
 // is very costly.
 
+// If compiled with '-DCOMPACTHEADER' (see './configure --compactheader')
+// the header of a clause only takes 16 instead of 24 bytes.  The glue is
+// then squeezed into the bits left over by the flags and saturates at
+// 'max_glue'.  The position of the last watch replacement 'pos' is stored
+// right after the literals (see 'saved_pos' and 'save_pos') and only for
+// clauses with more than three literals.  For ternary clauses it would
+// always be the third literal anyhow.  Not keeping it for slightly longer
+// clauses too changes the search considerably and was not better.
+
 struct Clause {
   union {
     uint64_t id;  // Used to create LRAT-style proofs
@@ -49,6 +58,9 @@ struct Clause {
   unsigned used : 2; // resolved in conflict analysis since last 'reduce'
   bool vivified : 1; // clause already vivified
   bool vivify : 1;   // clause scheduled to be vivified
+#ifdef COMPACTHEADER
+  unsigned glue : 13; // see below
+#endif
 
   // The glucose level ('LBD' or short 'glue') is a heuristic value for the
   // expected usefulness of a learned clause, where smaller glue is consider
@@ -84,10 +96,17 @@ struct Clause {
   // See 'mark_useless_redundant_clauses_as_garbage' in 'reduce.cpp' and
   // 'bump_clause' in 'analyze.cpp'.
   //
+#ifndef COMPACTHEADER
   int glue;
+#endif
 
   int size; // Actual size of 'literals' (at least 2).
-  int pos;  // Position of last watch replacement [Gent'13].
+#ifndef COMPACTHEADER
+  int pos; // Position of last watch replacement [Gent'13].
+#else
+  static const unsigned max_glue = (1u << 13) - 1;
+  static const int max_short_size = 3;
+#endif
 
   // This 'flexible array member' is of variadic 'size' (and actually
   // shrunken if strengthened) and keeps the literals close to the header of
@@ -124,6 +143,23 @@ struct Clause {
   const_literal_iterator begin () const { return literals; }
   const_literal_iterator end () const { return literals + size; }
 
+  // Where to continue searching for a replacement watch.  The slot after
+  // the literals is accessed through 'end ()', since without flexible
+  // array members 'literals' is declared with two elements only.
+
+#ifndef COMPACTHEADER
+  int saved_pos () const { return pos; }
+  void save_pos (int new_pos) { pos = new_pos; }
+#else
+  int saved_pos () const {
+    return size > max_short_size ? *end () : 2;
+  }
+  void save_pos (int new_pos) {
+    if (size > max_short_size)
+      *end () = new_pos;
+  }
+#endif
+
   static size_t bytes (int size) {
 
     // Memory sanitizer insists that clauses put into consecutive memory in
@@ -134,7 +170,12 @@ struct Clause {
     //
     assert (size > 1);
     const size_t header_bytes = sizeof (Clause);
+#ifndef COMPACTHEADER
     const size_t actual_literal_bytes = size * sizeof (int);
+#else
+    const size_t actual_literal_bytes =
+        (size + (size > max_short_size)) * sizeof (int);
+#endif
     size_t combined_bytes = header_bytes + actual_literal_bytes;
 #ifdef NFLEXIBLE
     const size_t faked_literals_bytes = sizeof ((Clause *) 0)->literals;
@@ -105,7 +105,7 @@ void Internal::protect_reasons () {
     if (!active (lit))
       continue;
     assert (val (lit));
-    Var &v = var (lit);
+    VarRef v = var (lit);
     assert (v.level > 0);
     Clause *reason = v.reason;
     if (!reason)
@@ -138,7 +138,7 @@ void Internal::unprotect_reasons () {
     if (!active (lit))
       continue;
     assert (val (lit));
-    Var &v = var (lit);
+    VarRef v = var (lit);
     assert (v.level > 0);
     Clause *reason = v.reason;
     if (!reason)
@@ -190,7 +190,7 @@ size_t Internal::flush_occs (int lit) {
 // hidden in 'Clause.collect', which for the root level context of
 // preprocessing is actually redundant.
 
-inline void Internal::flush_watches (int lit, Watches &saved) {
+inline void Internal::flush_watches (int lit, vector<Watch> &saved) {
   assert (saved.empty ());
   Watches &ws = watches (lit);
   const const_watch_iterator end = ws.end ();
@@ -198,12 +198,19 @@ inline void Internal::flush_watches (int lit, Watches &saved) {
   const_watch_iterator i;
   for (i = j; i != end; i++) {
     Watch w = *i;
-    Clause *c = w.clause;
+    Clause *c = watched_clause (w);
     if (c->collect ())
       continue;
-    if (c->moved)
-      c = w.clause = c->copy;
-    w.size = c->size;
+    // A moved clause has the same size and literals as its copy, which
+    // with '-DWATCH32' can only be accessed after 'arena.swap' though.
+    if (c->moved) {
+#ifndef WATCH32
+      w.clause = c->copy;
+#else
+      w.cref = arena.ref (c->copy);
+#endif
+    }
+    w.resize (c->size);
     const int new_blit_pos = (c->literals[0] == lit);
     LOG (c, "clause in flush_watch starting from %d", lit);
     assert (c->literals[!new_blit_pos] == lit); /*FW1*/
@@ -214,6 +221,13 @@ inline void Internal::flush_watches (int lit, Watches &saved) {
       saved.push_back (w);
   }
   ws.resize (j - ws.begin ());
+  if (bintab_valid) {
+    Watches &bs = binary_watches (lit);
+    bs.clear ();
+    for (const auto &w : ws)
+      bs.push_back (w);
+    shrink_vector (bs);
+  }
   for (const auto &w : saved)
     ws.push_back (w);
   saved.clear ();
@@ -226,7 +240,7 @@ void Internal::flush_all_occs_and_watches () {
       flush_occs (idx), flush_occs (-idx);
 
   if (watching ()) {
-    Watches tmp;
+    vector<Watch> tmp;
     for (auto idx : vars)
       flush_watches (idx, tmp), flush_watches (-idx, tmp);
   }
@@ -242,7 +256,7 @@ void Internal::update_reason_references () {
   for (auto &lit : trail) {
     if (!active (lit))
       continue;
-    Var &v = var (lit);
+    VarRef v = var (lit);
     Clause *c = v.reason;
     if (!c)
       continue;
@@ -269,6 +283,8 @@ void Internal::update_reason_references () {
 
 void Internal::delete_garbage_clauses () {
 
+  flush_external_reasons ();
+
   flush_all_occs_and_watches ();
 
   LOG ("deleting garbage clauses");
@@ -314,38 +330,23 @@ void Internal::copy_clause (Clause *c) {
        (void *) c->copy);
 }
 
-// This is the moving garbage collector.
-
-void Internal::copy_non_garbage_clauses () {
-
-  size_t collected_clauses = 0, collected_bytes = 0;
-  size_t moved_clauses = 0, moved_bytes = 0;
+// The order in which clauses are placed into the arena is determined by
+// the following function, which calls 'visit' on clauses in that order.
+// Clauses might be visited multiple times.  The visitor has to filter
+// those already visited as well as garbage clauses.
 
-  // First determine 'moved_bytes' and 'collected_bytes'.
-  //
-  for (const auto &c : clauses)
-    if (!c->collect ())
-      moved_bytes += c->bytes (), moved_clauses++;
-    else
-      collected_bytes += c->bytes (), collected_clauses++;
-
-  PHASE ("collect", stats.collections,
-         "moving %zd bytes %.0f%% of %zd non garbage clauses", moved_bytes,
-         percent (moved_bytes, collected_bytes + moved_bytes),
-         moved_clauses);
-  (void) moved_clauses, (void) collected_clauses, (void) collected_bytes;
-  // Prepare 'to' space of size 'moved_bytes'.
-  //
-  arena.prepare (moved_bytes);
+template <class Visitor>
+static void visit_clauses_in_arena_order (Internal *internal,
+                                          Visitor &visit) {
 
   // Keep clauses in arena in the same order.
   //
-  if (opts.arenacompact)
-    for (const auto &c : clauses)
-      if (!c->collect () && arena.contains (c))
-        copy_clause (c);
+  if (internal->opts.arenacompact)
+    for (const auto &c : internal->clauses)
+      if (internal->arena.compacted (c))
+        visit (c);
 
-  if (opts.arenatype == 1 || !watching ()) {
+  if (internal->opts.arenatype == 1 || !internal->watching ()) {
 
     // Localize according to current clause order.
 
@@ -360,11 +361,10 @@ void Internal::copy_non_garbage_clauses () {
     // relative order is kept, and actually already gives the largest
     // benefit due to better cache locality.
 
-    for (const auto &c : clauses)
-      if (!c->moved && !c->collect ())
-        copy_clause (c);
+    for (const auto &c : internal->clauses)
+      visit (c);
 
-  } else if (opts.arenatype == 2) {
+  } else if (internal->opts.arenatype == 2) {
 
     // Localize according to (original) variable order.
 
@@ -372,10 +372,10 @@ void Internal::copy_non_garbage_clauses () {
     // Our version uses saved phases too.
 
     for (int sign = -1; sign <= 1; sign += 2)
-      for (auto idx : vars)
-        for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+      for (auto idx : internal->vars)
+        for (const auto &w :
+             internal->watches (sign * internal->likely_phase (idx)))
+          visit (internal->watched_clause (w));
 
   } else {
 
@@ -385,21 +385,60 @@ void Internal::copy_non_garbage_clauses () {
     // the decision queue and also uses saved phases.  It seems faster than
     // the MiniSAT version and thus we keep 'opts.arenatype == 3'.
 
-    assert (opts.arenatype == 3);
+    assert (internal->opts.arenatype == 3);
 
     for (int sign = -1; sign <= 1; sign += 2)
-      for (int idx = queue.last; idx; idx = link (idx).prev)
-        for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+      for (int idx = internal->queue.last; idx;
+           idx = internal->link (idx).prev)
+        for (const auto &w :
+             internal->watches (sign * internal->likely_phase (idx)))
+          visit (internal->watched_clause (w));
   }
 
   // Do not forget to move clauses which are not watched, which happened in
   // a rare situation, and now is only left as defensive code.
   //
+  for (const auto &c : internal->clauses)
+    visit (c);
+}
+
+struct clause_copier {
+  Internal *internal;
+  clause_copier (Internal *i) : internal (i) {}
+  void operator() (Clause *c) {
+    if (!c->moved && !c->collect ())
+      internal->copy_clause (c);
+  }
+};
+
+// This is the moving garbage collector.
+
+void Internal::copy_non_garbage_clauses () {
+
+  flush_external_reasons ();
+
+  size_t collected_clauses = 0, collected_bytes = 0;
+  size_t moved_clauses = 0, moved_bytes = 0;
+
+  // First determine 'moved_bytes' and 'collected_bytes'.
+  //
   for (const auto &c : clauses)
-    if (!c->collect () && !c->moved)
-      copy_clause (c);
+    if (!c->collect ())
+      moved_bytes += c->bytes (), moved_clauses++;
+    else
+      collected_bytes += c->bytes (), collected_clauses++;
+
+  PHASE ("collect", stats.collections,
+         "moving %zd bytes %.0f%% of %zd non garbage clauses", moved_bytes,
+         percent (moved_bytes, collected_bytes + moved_bytes),
+         moved_clauses);
+  (void) moved_clauses, (void) collected_clauses, (void) collected_bytes;
+  // Prepare 'to' space of size 'moved_bytes'.
+  //
+  arena.prepare (moved_bytes);
+
+  clause_copier copier (this);
+  visit_clauses_in_arena_order (this, copier);
 
   flush_all_occs_and_watches ();
   update_reason_references ();
@@ -435,6 +474,176 @@ void Internal::copy_non_garbage_clauses () {
 
 /*------------------------------------------------------------------------*/
 
+// On huge formulas copying all clauses at once in 'reduce' can take
+// seconds, during which the search is stuck.  With 'opts.arenaincr' the
+// garbage collection in 'reduce' only deletes garbage clauses without
+// moving the others ('delete_garbage_clauses') and then just determines
+// the order in which the remaining clauses should be placed in the arena.
+// The clauses are then moved to the 'to' space of the arena in that order
+// in batches after each conflict, such that moving is spread over
+// 'opts.arenaincrint' conflicts.  Since during search clauses are always
+// watched by their first two literals it suffices to search those two
+// watch lists to redirect the watches of a moved clause.  Similarly only
+// the variables of these two literals can have the clause as reason, while
+// cached external reasons are found through the literals of the clause.
+
+// Incremental moving is restricted to search without inprocessing in
+// between.  Before any other procedure is scheduled as well as when search
+// stops the remaining clauses are moved at once.  During moving new clauses
+// are allocated outside of the nursery, which is reset by 'arena.swap'.
+
+bool Internal::incremental_arena () {
+#ifdef WATCH32
+  return false;
+#else
+  return opts.arenaincr && watching ();
+#endif
+}
+
+struct clause_scheduler {
+  vector<Clause *> &schedule;
+  clause_scheduler (vector<Clause *> &s) : schedule (s) {}
+  void operator() (Clause *c) {
+    if (c->moved)
+      return;
+    c->moved = true; // Used as mark only.
+    schedule.push_back (c);
+  }
+};
+
+void Internal::start_moving_clauses () {
+  assert (!moving_end);
+  assert (incremental_arena ());
+  size_t bytes = 0;
+  for (const auto &c : clauses)
+    bytes += c->bytes ();
+  arena.prepare (bytes);
+
+  // All clauses are scheduled including garbage reasons, which have not
+  // been deleted and remain watched.  Reordering 'clauses' in schedule
+  // order is what 'opts.arenasort' would achieve after moving anyhow.
+  //
+  vector<Clause *> schedule;
+  schedule.reserve (clauses.size ());
+  clause_scheduler scheduler (schedule);
+  visit_clauses_in_arena_order (this, scheduler);
+  assert (schedule.size () == clauses.size ());
+  for (const auto &c : schedule)
+    c->moved = false;
+  clauses.swap (schedule);
+
+  moving_next = 0;
+  moving_end = clauses.size ();
+  last.move.conflicts = stats.conflicts;
+  PHASE ("collect", stats.collections,
+         "moving %zd bytes of %zd clauses incrementally", bytes,
+         moving_end);
+  if (!moving_end)
+    arena.swap ();
+}
+
+#ifndef WATCH32
+
+// Redirect the watch of 'c' in 'ws' to its copy 'd' if found.
+
+static bool move_watch (Watches &ws, Clause *c, Clause *d) {
+  for (auto &w : ws)
+    if (w.clause == c) {
+      w.clause = d;
+      return true;
+    }
+  return false;
+}
+
+#endif
+
+void Internal::move_clause (size_t i) {
+  Clause *c = clauses[i];
+  copy_clause (c);
+  Clause *d = c->copy;
+#ifdef WATCH32
+  assert (false); // Excluded by 'incremental_arena'.
+#else
+  for (int j = 0; j < 2; j++) {
+    const int lit = d->literals[j];
+    // Watches of garbage clauses might have been dropped in 'propagate'.
+    const bool found = move_watch (watches (lit), c, d);
+    assert (found || d->garbage);
+    (void) found;
+    // Clauses shrunken to binary clauses might not be in 'bintab', which
+    // is fine as binary watches are still found in 'wtab' too.
+    if (bintab_valid && d->size == 2)
+      (void) move_watch (binary_watches (lit), c, d);
+  }
+#endif
+  // During search the literal implied by a reason is always watched.
+  for (int j = 0; j < 2; j++) {
+    VarRef v = var (d->literals[j]);
+    if (v.reason == c)
+      v.reason = d;
+  }
+#ifndef NDEBUG
+  for (const auto &lit : *d)
+    assert (!val (lit) || var (lit).reason != c);
+#endif
+  // Cached external reasons are indexed by the literal they propagated.
+  if (!ext_reasons.empty ())
+    for (const auto &lit : *d) {
+      const unsigned ulit = vlit (lit);
+      if (ulit < ext_reasons.size () && ext_reasons[ulit] == c)
+        ext_reasons[ulit] = d;
+    }
+  clauses[i] = d;
+  deallocate_clause (c);
+}
+
+// Moving is pending if there was a conflict since the last batch or if
+// the next procedure requires all clauses to be moved.
+
+bool Internal::moving () {
+  if (!moving_end)
+    return false;
+  if (stats.conflicts > last.move.conflicts)
+    return true;
+  return rephasing () || reducing () || probing () || subsuming () ||
+         eliminating () || compacting () || conditioning ();
+}
+
+void Internal::move_clauses () {
+  assert (moving_end);
+  if (stats.conflicts == last.move.conflicts) {
+    finish_moving_clauses ();
+    return;
+  }
+  START (collect);
+  assert (!conflict);
+  last.move.conflicts = stats.conflicts;
+  const size_t batch = 1 + moving_end / opts.arenaincrint;
+  const size_t end = moving_next + min (batch, moving_end - moving_next);
+  while (moving_next < end)
+    move_clause (moving_next++);
+  STOP (collect);
+  if (moving_next == moving_end)
+    finish_moving_clauses ();
+}
+
+void Internal::finish_moving_clauses () {
+  assert (moving_end);
+  START (collect);
+  const size_t remaining = moving_end - moving_next;
+  while (moving_next < moving_end)
+    move_clause (moving_next++);
+  arena.swap ();
+  PHASE ("collect", stats.collections,
+         "moved %zd clauses incrementally (%zd remaining at once)",
+         moving_end, remaining);
+  (void) remaining;
+  moving_next = moving_end = 0;
+  STOP (collect);
+}
+
+/*------------------------------------------------------------------------*/
+
 // Maintaining clause statistics is complex and error prone but necessary
 // for proper scheduling of garbage collection, particularly during bounded
 // variable elimination.  With this function we can check whether these
@@ -473,7 +682,7 @@ void Internal::remove_garbage_binaries () {
   if (!protected_reasons)
     protect_reasons ();
   int backtrack_level = level + 1;
-  Watches saved;
+  vector<Watch> saved;
   for (auto v : vars) {
     for (auto lit : {-v, v}) {
       assert (saved.empty ());
@@ -484,7 +693,7 @@ void Internal::remove_garbage_binaries () {
       for (i = j; i != end; i++) {
         Watch w = *i;
         *j++ = w;
-        Clause *c = w.clause;
+        Clause *c = watched_clause (w);
         COVER (!w.binary () && c->size == 2);
         if (!w.binary ())
           continue;
@@ -506,6 +715,7 @@ void Internal::remove_garbage_binaries () {
       shrink_vector (ws);
     }
   }
+  bintab_valid = false;
   delete_garbage_clauses ();
   unprotect_reasons ();
   if (backtrack_level - 1 < level)
@@ -515,9 +725,19 @@ void Internal::remove_garbage_binaries () {
 
 /*------------------------------------------------------------------------*/
 
-bool Internal::arenaing () { return opts.arena && (stats.collections > 1); }
+// With '-DWATCH32' all clauses are allocated in the arena, which thus has
+// to be compacted by every garbage collection.
 
-void Internal::garbage_collection () {
+bool Internal::arenaing () {
+#ifdef WATCH32
+  return true;
+#else
+  return opts.arena && (stats.collections > 1);
+#endif
+}
+
+void Internal::garbage_collection (bool incremental) {
+  assert (!moving_end);
   if (unsat)
     return;
   START (collect);
@@ -526,10 +746,16 @@ void Internal::garbage_collection () {
   mark_satisfied_clauses_as_garbage ();
   if (!protected_reasons)
     protect_reasons ();
-  if (arenaing ())
-    copy_non_garbage_clauses ();
-  else
+  if (!arenaing ())
     delete_garbage_clauses ();
+  else if (incremental && incremental_arena ())
+    delete_garbage_clauses (), start_moving_clauses ();
+  else
+    copy_non_garbage_clauses ();
+#ifdef WATCHPOOL
+  if (watching ())
+    wpool.compact ();
+#endif
   check_clause_stats ();
   check_var_stats ();
   unprotect_reasons ();
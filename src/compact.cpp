@@ -157,7 +157,9 @@ struct Mapper {
 
 /*------------------------------------------------------------------------*/
 
+#ifndef COLOCATE
 static signed char *ignore_clang_analyze_memory_leak_warning;
+#endif
 
 void Internal::compact () {
 
@@ -166,6 +168,7 @@ void Internal::compact () {
   assert (active () < max_var);
 
   stats.compacts++;
+  flush_external_reasons ();
 
   assert (!level);
   assert (!unsat);
@@ -384,8 +387,20 @@ void Internal::compact () {
     }
     relevanttab.resize (mapper.new_vsize);
     shrink_vector (relevanttab);
+    for (size_t idx = 0; idx < relevanttab.size (); idx++)
+      ftab[idx].observed = relevanttab[idx] > 0;
   }
 
+  // Decision priorities are mapped as list and their positions recomputed.
+  //
+  mapper.map_flush_and_shrink_lits (priorities);
+  priotab.resize (mapper.new_vsize);
+  shrink_vector (priotab);
+  clear_n (priotab.data (), priotab.size ());
+  for (size_t i = 0; i < priorities.size (); i++)
+    priotab[priorities[i]] = i + 1;
+  priority_unassigned = 0;
+
   /*----------------------------------------------------------------------*/
 
   if (!external->assumptions.empty ()) {
@@ -408,8 +423,14 @@ void Internal::compact () {
 
   // Special case for 'val' as for 'val' we trade branch less code for
   // memory and always allocated an [-maxvar,...,maxvar] array.
+#ifndef COLOCATE
   {
-    signed char *new_vals = new signed char[2 * mapper.new_vsize];
+    size_t bytes = 2 * mapper.new_vsize;
+#ifdef SIMD_PADDING
+    bytes += SIMD_PADDING;
+#endif
+    signed char *new_vals = new signed char[bytes];
+    huge_pages (new_vals, bytes);
     ignore_clang_analyze_memory_leak_warning = new_vals;
     new_vals += mapper.new_vsize;
     for (auto src : vars)
@@ -420,8 +441,9 @@ void Internal::compact () {
     vals -= vsize;
     delete[] vals;
     vals = new_vals;
-    vsize = mapper.new_vsize;
   }
+#endif
+  vsize = mapper.new_vsize;
 
   // 'constrain' uses 'val', so this code has to be after remapping that
   if (is_constraint) {
@@ -449,11 +471,22 @@ void Internal::compact () {
   mapper.map_vector (btab);
   mapper.map_vector (gtab);
   mapper.map_vector (links);
+#ifndef COLOCATE
   mapper.map_vector (vtab);
+#else
+  mapper.map_vector (atab);
+  mapper.map_vector (rtab);
+#endif
   if (!ntab.empty ())
     mapper.map2_vector (ntab);
   if (!wtab.empty ())
     mapper.map2_vector (wtab);
+  erase_vector (bintab);
+  bintab_valid = false;
+#ifdef WATCHPOOL
+  if (!wtab.empty ())
+    wpool.compact ();
+#endif
   if (!otab.empty ())
     mapper.map2_vector (otab);
   if (!big.empty ())
@@ -491,6 +524,17 @@ void Internal::compact () {
     scores.shrink ();
   }
 
+  // Mapping reallocated the hot tables (which are smaller now).
+  //
+#ifndef COLOCATE
+  huge_pages (vtab);
+#else
+  huge_pages (atab);
+  huge_pages (rtab);
+#endif
+  huge_pages (wtab);
+  huge_pages (stab);
+
   /*----------------------------------------------------------------------*/
 
   PHASE ("compact", stats.compacts,
@@ -176,7 +176,7 @@ long Internal::condition_round (long delta) {
 
   for (auto idx : vars) {
     const signed char tmp = val (idx);
-    Var &v = var (idx);
+    VarRef v = var (idx);
     if (tmp) {
       if (v.level) {
         const int lit = tmp < 0 ? -idx : idx;
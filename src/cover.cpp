@@ -67,7 +67,7 @@ inline void Internal::covered_literal_addition (int lit, Coveror &coveror) {
   cover_push_extension (lit, coveror);
   for (const auto &other : coveror.intersection) {
     LOG ("covered literal addition %d", other);
-    assert (!vals[other]), assert (!vals[-other]);
+    assert (!val (other));
     set_val (other, -1);
     coveror.covered.push_back (other);
     coveror.added.push_back (other);
@@ -83,7 +83,7 @@ inline void Internal::asymmetric_literal_addition (int lit,
   require_mode (COVER);
   assert (level == 1);
   LOG ("initial asymmetric literal addition %d", lit);
-  assert (!vals[lit]), assert (!vals[-lit]);
+  assert (!val (lit));
   set_val (lit, -1);
   coveror.added.push_back (lit);
   coveror.alas++;
@@ -110,30 +110,31 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
   const_watch_iterator i = j;
   while (!subsumed && i != eow) {
     const Watch w = *j++ = *i++;
-    if (w.clause == ignore)
+    Clause *c = watched_clause (w);
+    if (c == ignore)
       continue; // costly but necessary here ...
     const signed char b = val (w.blit);
     if (b > 0)
       continue;
-    if (w.clause->garbage)
+    if (c->garbage)
       j--;
     else if (w.binary ()) {
       if (b < 0) {
-        LOG (w.clause, "found subsuming");
+        LOG (c, "found subsuming");
         subsumed = true;
       } else
         asymmetric_literal_addition (-w.blit, coveror);
     } else {
-      literal_iterator lits = w.clause->begin ();
+      literal_iterator lits = c->begin ();
       const int other = lits[0] ^ lits[1] ^ lit;
       lits[0] = other, lits[1] = lit;
       const signed char u = val (other);
       if (u > 0)
         j[-1].blit = other;
       else {
-        const int size = w.clause->size;
+        const int size = c->size;
         const const_literal_iterator end = lits + size;
-        const literal_iterator middle = lits + w.clause->pos;
+        const literal_iterator middle = lits + c->saved_pos ();
         literal_iterator k = middle;
         signed char v = -1;
         int r = 0;
@@ -141,26 +142,26 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
           k++;
         if (v < 0) {
           k = lits + 2;
-          assert (w.clause->pos <= size);
+          assert (c->saved_pos () <= size);
           while (k != middle && (v = val (r = *k)) < 0)
             k++;
         }
-        w.clause->pos = k - lits;
-        assert (lits + 2 <= k), assert (k <= w.clause->end ());
+        c->save_pos (k - lits);
+        assert (lits + 2 <= k), assert (k <= c->end ());
         if (v > 0)
           j[-1].blit = r;
         else if (!v) {
-          LOG (w.clause, "unwatch %d in", lit);
+          LOG (c, "unwatch %d in", lit);
           lits[1] = r;
           *k = lit;
-          watch_literal (r, lit, w.clause);
+          watch_literal (r, lit, c);
           j--;
         } else if (!u) {
           assert (v < 0);
           asymmetric_literal_addition (-other, coveror);
         } else {
           assert (u < 0), assert (v < 0);
-          LOG (w.clause, "found subsuming");
+          LOG (c, "found subsuming");
           subsumed = true;
           break;
         }
@@ -44,6 +44,26 @@ int Internal::next_decision_variable () {
     return next_decision_variable_on_queue ();
 }
 
+// Observed variables prioritized by the external propagator (through
+// 'prioritize_observed_vars') are decided before all other variables and
+// in the given order, without asking the propagator through 'cb_decide'
+// (see 'ask_decision', which first notifies pending assignments).
+// All variables before 'priority_unassigned' are assigned, which is
+// maintained during backtracking in 'unassign' as for the queue.  Those
+// which are not observed anymore are skipped.
+
+int Internal::next_prioritized_variable () {
+  while (priority_unassigned < priorities.size ()) {
+    const int idx = priorities[priority_unassigned];
+    if (!val (idx) && flags (idx).observed) {
+      LOG ("next prioritized decision variable %d", idx);
+      return idx;
+    }
+    priority_unassigned++;
+  }
+  return 0;
+}
+
 /*------------------------------------------------------------------------*/
 
 // Implements phase saving as well using a target phase during
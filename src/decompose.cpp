@@ -292,7 +292,7 @@ bool Internal::decompose_round () {
                     DFS &child_dfs = dfs[vlit (child)];
                     if (child_dfs.parent)
                       continue;
-                    child_dfs.parent = w.clause;
+                    child_dfs.parent = watched_clause (w);
                     todo.push_back (child);
                   }
                 }
@@ -643,8 +643,10 @@ bool Internal::decompose_round () {
         mark_added (c);
       // we have assert (c->size > 2)
       if (c->size == 2) { // cheaper to update only new binary clauses
-        update_watch_size (watches (c->literals[0]), c->literals[1], c);
-        update_watch_size (watches (c->literals[1]), c->literals[0], c);
+        update_watch_size (watches (c->literals[0]), c->literals[1],
+                           clause_ref (c), 2);
+        update_watch_size (watches (c->literals[1]), c->literals[0],
+                           clause_ref (c), 2);
       }
       LOG (c, "substituted");
     }
@@ -64,7 +64,7 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
           continue;
         int other = w.blit;
         const int tmp = marked (other);
-        Clause *c = w.clause;
+        Clause *c = watched_clause (w);
 
         if (tmp > 0) { // Found duplicated binary clause.
 
@@ -86,7 +86,7 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
                 continue;
               if (k->blit != other)
                 continue;
-              Clause *d = k->clause;
+              Clause *d = watched_clause (*k);
               if (d->garbage)
                 continue;
               c = d;
@@ -119,7 +119,7 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
                 continue;
               if (k->blit != -other)
                 continue;
-              lrat_chain.push_back (k->clause->id);
+              lrat_chain.push_back (watched_clause (*k)->id);
               break;
             }
           }
@@ -138,6 +138,8 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
         erase_vector (ws);
       else if (j != end)
         ws.resize (j - ws.begin ()); // Shrink watchers.
+      if (j != end)
+        bintab_valid = false;
 
       for (const auto &other : stack)
         unmark (other);
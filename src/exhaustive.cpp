@@ -1,7 +1,12 @@
 #include "exhaustive.hpp"
 #include <iostream>
 
-ExhaustiveSearch::ExhaustiveSearch(CaDiCaL::Solver * s, int order, bool only_neg, FILE * solfile, bool can_forget) : solver(s) {
+// Unless subclasses need to see partial assignments ('partial' is set),
+// the solver only wakes the propagator up once all 'n' observed variables
+// are assigned, and thus notifications and callbacks on partial
+// assignments are avoided.
+
+ExhaustiveSearch::ExhaustiveSearch(CaDiCaL::Solver * s, int order, bool only_neg, FILE * solfile, bool can_forget, bool partial) : solver(s) {
     if (order == 0) {
         // No order provided; run exhaustive search on all variables
         n = s->vars();
@@ -12,13 +17,12 @@ ExhaustiveSearch::ExhaustiveSearch(CaDiCaL::Solver * s, int order, bool only_neg
     this->solfile = solfile;
     this->can_forget = can_forget;
     assign = new char[n];
+    if (!partial) observed_threshold = n;
     solver->connect_external_propagator(this);
     for (int i = 0; i < n; i++) {
         assign[i] = l_Undef;
     }
     std::cout << "c Running exhaustive search on " << n << " variables" << std::endl;
-    // The root-level of the trail is always there
-    current_trail.push_back(std::vector<int>());
     // Observe the variables used for exhaustive generation
     for (int i = 0; i < n; i++) {
         solver->add_observed_var(i+1);
@@ -30,53 +34,41 @@ ExhaustiveSearch::~ExhaustiveSearch () {
         solver->disconnect_external_propagator ();
         delete [] assign;
         std::cout << "c Number of solutions: " << sol_count << std::endl;
-#ifdef PRINT_CALLBACK_TIME
-        std::cout << "c Time spent in IPASIR-UP callbacks: " << callback_time << " sec" << std::endl;
-#endif
     }
 }
 
-void ExhaustiveSearch::notify_assignment(const std::vector<int>& lits) {
-#ifdef PRINT_CALLBACK_TIME
-    clock_t begin = clock();
-#endif
-    for(int lit : lits) {
-        if (assign[abs(lit)-1] == l_Undef) {
-            num_assign++;
-            assign[abs(lit)-1] = (lit > 0 ? l_True : l_False);
-            current_trail.back().push_back(lit);
-        }
+// Lets the solver decide the observed variables first and in order, which
+// replaces asking 'cb_decide' on every decision.
+
+void ExhaustiveSearch::prioritize () {
+    std::vector<int> vars;
+    for (int i = 0; i < n; i++) {
+        vars.push_back(i+1);
     }
-#ifdef PRINT_CALLBACK_TIME
-    callback_time += (double)(clock() - begin) / CLOCKS_PER_SEC;
-#endif
+    solver->prioritize_observed_vars(vars);
 }
 
-void ExhaustiveSearch::notify_new_decision_level () {
-#ifdef PRINT_CALLBACK_TIME
-    clock_t begin = clock();
-#endif
-    current_trail.push_back(std::vector<int>());
-#ifdef PRINT_CALLBACK_TIME
-    callback_time += (double)(clock() - begin) / CLOCKS_PER_SEC;
-#endif
+// The solver keeps the trail of observed literals for us, thus there is
+// nothing to copy and backtracking just resets the literals above the
+// first backtracked level.
+
+void ExhaustiveSearch::notify_trail (const CaDiCaL::ExternalTrail & view, size_t from) {
+    trail = &view;
+    for (size_t i = from; i < view.size; i++) {
+        const int lit = view.lits[i];
+        assert (assign[abs(lit)-1] == l_Undef);
+        num_assign++;
+        assign[abs(lit)-1] = (lit > 0 ? l_True : l_False);
+    }
 }
 
 void ExhaustiveSearch::notify_backtrack (size_t new_level) {
-#ifdef PRINT_CALLBACK_TIME
-    clock_t begin = clock();
-#endif
-    while (current_trail.size() > new_level + 1) {
-        for (const auto& lit: current_trail.back()) {
-            const int x = abs(lit) - 1;
-            assign[x] = l_Undef;
+    if (trail && new_level < trail->level) {
+        for (size_t i = trail->levels[new_level]; i < trail->size; i++) {
+            assign[abs(trail->lits[i])-1] = l_Undef;
             num_assign--;
         }
-        current_trail.pop_back();
     }
-#ifdef PRINT_CALLBACK_TIME
-    callback_time += (double)(clock() - begin) / CLOCKS_PER_SEC;
-#endif
 }
 
 bool ExhaustiveSearch::cb_check_found_model (const std::vector<int> & model) {
@@ -85,9 +77,6 @@ bool ExhaustiveSearch::cb_check_found_model (const std::vector<int> & model) {
 }
 
 bool ExhaustiveSearch::cb_has_external_clause (bool& is_forgettable) {
-#ifdef PRINT_CALLBACK_TIME
-    clock_t begin = clock();
-#endif
     is_forgettable = can_forget;
     // If not all observed variables have been assigned then no blocking clause to learn
     if (num_assign < n) return false;
@@ -128,16 +117,10 @@ bool ExhaustiveSearch::cb_has_external_clause (bool& is_forgettable) {
 #endif
     new_clauses.push_back(clause);
     solver->add_trusted_clause(clause);
-#ifdef PRINT_CALLBACK_TIME
-    callback_time += (double)(clock() - begin) / CLOCKS_PER_SEC;
-#endif
     return true;
 }
 
 int ExhaustiveSearch::cb_add_external_clause_lit () {
-#ifdef PRINT_CALLBACK_TIME
-    clock_t begin = clock();
-#endif
     if (new_clauses.empty()) return 0;
     else {
         assert(!new_clauses.empty());
@@ -151,9 +134,18 @@ int ExhaustiveSearch::cb_add_external_clause_lit () {
         new_clauses[clause_idx].pop_back();
         return lit;
     }
-#ifdef PRINT_CALLBACK_TIME
-    callback_time += (double)(clock() - begin) / CLOCKS_PER_SEC;
-#endif
+}
+
+// Blocking clauses have one literal per observed variable, thus they are
+// passed as a whole instead of literal by literal.
+
+bool ExhaustiveSearch::cb_add_external_clause (const int *& lits, size_t & size) {
+    assert(!new_clauses.empty());
+    handed = std::move(new_clauses.back());
+    new_clauses.pop_back();
+    lits = handed.data();
+    size = handed.size();
+    return true;
 }
 
 int ExhaustiveSearch::cb_decide () { return 0; }
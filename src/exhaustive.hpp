@@ -1,13 +1,18 @@
+#ifndef _exhaustive_hpp_INCLUDED
+#define _exhaustive_hpp_INCLUDED
+
 #include "internal.hpp"
 
 #define l_False 0
 #define l_True 1
 #define l_Undef 2
 
-class ExhaustiveSearch : CaDiCaL::ExternalPropagator {
+class ExhaustiveSearch : CaDiCaL::TrailViewPropagator {
+protected:
     CaDiCaL::Solver * solver;
     std::vector<std::vector<int>> new_clauses;
-    std::vector<std::vector<int>> current_trail;
+    std::vector<int> handed;        // clause passed as a whole
+    const CaDiCaL::ExternalTrail * trail = 0;
     int num_assign = 0;
     char * assign;
     //bool * fixed;
@@ -16,19 +21,19 @@ class ExhaustiveSearch : CaDiCaL::ExternalPropagator {
     long sol_count = 0;
     FILE * solfile;
     bool can_forget = false;
-#ifdef PRINT_CALLBACK_TIME
-    double callback_time = 0;
-#endif
 public:
-    ExhaustiveSearch(CaDiCaL::Solver * s, int order, bool only_neg, FILE * solfile, bool can_forget);
+    ExhaustiveSearch(CaDiCaL::Solver * s, int order, bool only_neg, FILE * solfile, bool can_forget, bool partial = false);
     ~ExhaustiveSearch ();
-    void notify_assignment(const std::vector<int>& lits);
-    void notify_new_decision_level ();
+    void prioritize ();
+    void notify_trail (const CaDiCaL::ExternalTrail & view, size_t from);
     void notify_backtrack (size_t new_level);
     bool cb_check_found_model (const std::vector<int> & model);
     bool cb_has_external_clause (bool& is_forgettable);
     int cb_add_external_clause_lit ();
+    bool cb_add_external_clause (const int *& lits, size_t & size);
     int cb_decide ();
     int cb_propagate ();
     int cb_add_reason_clause_lit (int plit);
 };
+
+#endif
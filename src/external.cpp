@@ -379,8 +379,15 @@ void External::add_observed_var (int elit) {
   // internal add-observed-var had to backtrack to root-level already
   assert (!internal->level);
 
+  if (propagator->uses_trail_view) {
+    internal->notify_fixed_observed (unit);
+    return;
+  }
+
   std::vector<int> assigned = {unit};
+  const uint64_t started = internal->start_callback ();
   propagator->notify_assignment (assigned);
+  internal->stop_callback (internal->stats.ext_cb.notify, started, 1);
 }
 
 void External::remove_observed_var (int elit) {
@@ -413,6 +420,8 @@ void External::reset_observed_vars () {
   internal->notified = 0;
   LOG ("reset notified counter to 0");
 
+  internal->reset_priorities ();
+
   if (!is_observed.size ())
     return;
 
@@ -431,6 +440,18 @@ void External::reset_observed_vars () {
   }
 }
 
+void External::prioritize_observed_var (int elit) {
+  assert (elit);
+  assert (elit != INT_MIN);
+  const int eidx = abs (elit);
+  if (!propagator || eidx >= (int) is_observed.size () ||
+      !is_observed[eidx]) {
+    LOG ("ignoring decision priority of unobserved variable %d", eidx);
+    return;
+  }
+  internal->prioritize_observed_var (e2i[eidx]);
+}
+
 bool External::observed (int elit) {
   assert (elit);
   assert (elit != INT_MIN);
@@ -117,6 +117,7 @@ struct External {
   void add_observed_var (int elit);
   void remove_observed_var (int elit);
   void reset_observed_vars ();
+  void prioritize_observed_var (int elit);
 
   bool observed (int elit);
   bool is_witness (int elit);
@@ -13,7 +13,8 @@ void Internal::add_observed_var (int ilit) {
     relevanttab.resize (1 + (size_t) idx, 0);
   unsigned &ref = relevanttab[idx];
   if (ref < UINT_MAX) {
-    ref++;
+    if (!ref++)
+      flags (idx).observed = true;
     LOG ("variable %d is observed %u times", idx, ref);
   } else
     LOG ("variable %d remains observed forever", idx);
@@ -50,9 +51,10 @@ void Internal::remove_observed_var (int ilit) {
   unsigned &ref = relevanttab[idx];
   assert (fixed (ilit) || ref > 0);
   if (fixed (ilit))
-    ref = 0;
+    ref = 0, flags (idx).observed = false;
   else if (ref < UINT_MAX) {
     if (!--ref) {
+      flags (idx).observed = false;
       LOG ("variable %d is not observed anymore", idx);
     } else
       LOG ("variable %d is unobserved once but remains observed %u times",
@@ -63,11 +65,25 @@ void Internal::remove_observed_var (int ilit) {
 
 /*----------------------------------------------------------------------------*/
 //
-// Supposed to be used only by mobical.
+// Append an observed variable to the decision priorities (see
+// 'next_prioritized_variable').  Variables already prioritized keep their
+// earlier position.
 //
-bool Internal::observed (int ilit) const {
-  assert ((size_t) vidx (ilit) < relevanttab.size ());
-  return relevanttab[vidx (ilit)] > 0;
+void Internal::prioritize_observed_var (int ilit) {
+  const int idx = vidx (ilit);
+  assert (flags (idx).observed);
+  if (priotab[idx])
+    return;
+  priorities.push_back (idx);
+  priotab[idx] = priorities.size ();
+  LOG ("variable %d prioritized at position %zu", idx, priorities.size ());
+}
+
+void Internal::reset_priorities () {
+  for (const auto idx : priorities)
+    priotab[idx] = 0;
+  erase_vector (priorities);
+  priority_unassigned = 0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -145,13 +161,25 @@ void Internal::renotify_full_trail () {
       current_level = var (ilit).level;
 
     if (current_level > propagator_level) {
-      if (assigned.size ())
-        external->propagator->notify_assignment (assigned);
-      while (current_level > propagator_level) {
-        external->propagator->notify_new_decision_level ();
-        propagator_level++;
+      if (external_prop_view) {
+        while (current_level > propagator_level) {
+          elevels.push_back (etrail.size ());
+          propagator_level++;
+        }
+      } else {
+        if (assigned.size ()) {
+          const uint64_t started = start_callback ();
+          external->propagator->notify_assignment (assigned);
+          stop_callback (stats.ext_cb.notify, started, assigned.size ());
+        }
+        while (current_level > propagator_level) {
+          const uint64_t started = start_callback ();
+          external->propagator->notify_new_decision_level ();
+          stop_callback (stats.ext_cb.notify, started, 0);
+          propagator_level++;
+        }
+        assigned.clear ();
       }
-      assigned.clear ();
     }
     // Current level can be smaller than prev_max_level due to chrono
     if (current_level > prev_max_level)
@@ -167,20 +195,37 @@ void Internal::renotify_full_trail () {
     // This happens on root level, so notification about their assignment is
     // already done.
     assert (external->observed (elit) || fixed (ilit));
-    assigned.push_back (elit);
+    if (external_prop_view)
+      push_trail_view (elit);
+    else
+      assigned.push_back (elit);
   }
-  if (assigned.size ())
+  if (assigned.size ()) {
+    const uint64_t started = start_callback ();
     external->propagator->notify_assignment (assigned);
+    stop_callback (stats.ext_cb.notify, started, assigned.size ());
+  }
   assigned.clear ();
 
   // In case there are some left over empty levels on the top of the trail,
   // the external propagtor must be notified about them so the levels are
   // synced
   while (level > propagator_level) {
-    external->propagator->notify_new_decision_level ();
+    if (external_prop_view)
+      elevels.push_back (etrail.size ());
+    else {
+      const uint64_t started = start_callback ();
+      external->propagator->notify_new_decision_level ();
+      stop_callback (stats.ext_cb.notify, started, 0);
+    }
     propagator_level++;
   }
 
+  if (external_prop_view) {
+    update_trail_view ();
+    notify_trail_view ();
+  }
+
   return;
 }
 
@@ -193,7 +238,7 @@ bool Internal::is_decision (int ilit) {
     return false;
 
   const int idx = vidx (ilit);
-  Var &v = var (idx);
+  VarRef v = var (idx);
 #ifndef NDEBUG
   LOG (v.reason,
        "is_decision: i%d (current level: %d, is_fixed: %d, v.level: %d, "
@@ -220,8 +265,9 @@ void Internal::force_backtrack (size_t new_level) {
 
 /*----------------------------------------------------------------------------*/
 //
-// Call external propagator to check if there is a literal to be propagated.
-// The reason of the propagation is not necessarily asked at that point.
+// Call external propagator to check if there is a literal (or a batch of
+// literals) to be propagated. The reason of the propagation is not
+// necessarily asked at that point.
 //
 // In case the externally propagated literal is already falsified, the
 // reason is asked and conflict analysis starts. In case the externally
@@ -245,66 +291,83 @@ bool Internal::external_propagate () {
     // external->reset_extended (); //TODO for inprocessing
 
     notify_assignments ();
+    if (external_prop_asleep ())
+      break;
 
-    int elit = external->propagator->cb_propagate ();
-    stats.ext_prop.ext_cb++;
-    stats.ext_prop.eprop_call++;
-    while (elit) {
-      assert (external->is_observed[abs (elit)]);
-      int ilit = external->e2i[abs (elit)];
-      if (elit < 0)
-        ilit = -ilit;
-      int tmp = val (ilit);
+    // The propagator can return a batch of literals at once, which are all
+    // assigned (with lazily explained reasons) before propagating them
+    // together, otherwise single literals are asked with 'cb_propagate'.
+    const int *lits;
+    size_t size;
+    for (;;) {
+      const uint64_t started = start_callback ();
+      if (!external->propagator->cb_propagate_batch (lits, size)) {
+        ext_batch_lit = external->propagator->cb_propagate ();
+        lits = &ext_batch_lit;
+        size = ext_batch_lit != 0;
+      }
+      stop_callback (stats.ext_cb.propagate, started, size);
+      stats.ext_prop.ext_cb++;
+      stats.ext_prop.eprop_call++;
+      if (!size)
+        break;
+      if (size > 1)
+        stats.ext_prop.eprop_batch++;
+      // Explaining falsified literals calls back into the propagator, which
+      // might invalidate 'lits', thus it is copied.
+      ext_batch.assign (lits, lits + size);
+      bool trail_changed = false;
+      for (const auto elit : ext_batch) {
+        assert (external->is_observed[abs (elit)]);
+        int ilit = external->e2i[abs (elit)];
+        if (elit < 0)
+          ilit = -ilit;
+        int tmp = val (ilit);
 #ifndef NDEBUG
-      assert (fixed (ilit) || observed (ilit));
-      LOG ("External propagation of e%d (i%d val: %d)", elit, ilit, tmp);
+        assert (fixed (ilit) || observed (ilit));
+        LOG ("External propagation of e%d (i%d val: %d)", elit, ilit, tmp);
+#endif
+        if (!tmp) {
+          // variable is not assigned, it can be propagated
+          if (!level) {
+            Clause *res = learn_external_reason_clause (ilit, elit);
+#ifndef LOGGING
+            LOG (res, "reason clause of external propagation of %d:", elit);
 #endif
-      if (!tmp) {
-        // variable is not assigned, it can be propagated
-        if (!level) {
+            (void) res;
+          } else
+            search_assign_external (ilit);
+          stats.ext_prop.eprop_prop++;
+          trail_changed = true;
+          if (unsat || conflict)
+            break;
+        } else if (tmp < 0) {
+          LOG ("External propgation of %d is falsified under current trail",
+               ilit);
+          stats.ext_prop.eprop_conf++;
+          int level_before = level;
+          size_t assigned = num_assigned;
           Clause *res = learn_external_reason_clause (ilit, elit);
 #ifndef LOGGING
           LOG (res, "reason clause of external propagation of %d:", elit);
 #endif
           (void) res;
-        } else
-          search_assign_external (ilit);
-        stats.ext_prop.eprop_prop++;
-
-        if (unsat || conflict)
+          if (num_assigned != assigned || level != level_before ||
+              propagated < trail.size ())
+            trail_changed = true;
+          // The remaining literals of the batch are dropped, since the
+          // trail might have changed.  They are asked for again.
           break;
+        } // else (tmp > 0) -> the case of a satisfied literal is ignored
+      }
+      if (unsat || conflict)
+        break;
+      if (trail_changed) {
         propagate ();
         if (unsat || conflict)
           break;
         notify_assignments ();
-      } else if (tmp < 0) {
-        LOG ("External propgation of %d is falsified under current trail",
-             ilit);
-        stats.ext_prop.eprop_conf++;
-        int level_before = level;
-        size_t assigned = num_assigned;
-        Clause *res = learn_external_reason_clause (ilit, elit);
-#ifndef LOGGING
-        LOG (res, "reason clause of external propagation of %d:", elit);
-#endif
-        (void) res;
-        bool trail_changed =
-            (num_assigned != assigned || level != level_before ||
-             propagated < trail.size ());
-
-        if (unsat || conflict)
-          break;
-
-        if (trail_changed) {
-          propagate ();
-          if (unsat || conflict)
-            break;
-          notify_assignments ();
-        }
-      } // else (tmp > 0) -> the case of a satisfied literal is ignored
-      elit = external->propagator->cb_propagate ();
-      stats.ext_prop.ext_cb++;
-      stats.ext_prop.eprop_call++;
+      }
     }
 
 #ifndef NDEBUG
@@ -361,6 +424,8 @@ bool Internal::external_propagate () {
 
           notify_assignments ();
         }
+        if (external_prop_asleep ())
+          break;
         has_external_clause = ask_external_clause ();
         stats.ext_prop.ext_cb++;
         stats.ext_prop.elearn_call++;
@@ -386,8 +451,10 @@ bool Internal::external_propagate () {
 
 bool Internal::ask_external_clause () {
   ext_clause_forgettable = false;
+  const uint64_t started = start_callback ();
   bool res =
       external->propagator->cb_has_external_clause (ext_clause_forgettable);
+  stop_callback (stats.ext_cb.clause, started, 0);
 
   return res;
 }
@@ -448,9 +515,11 @@ void Internal::move_literals_to_watch () {
 /*----------------------------------------------------------------------------*/
 //
 // Reads out from the external propagator the lemma/proapgation reason
-// clause literal by literal. In case propagated_elit is 0, it is about an
-// external clause via 'cb_add_external_clause_lit'. Otherwise, it is about
-// learning the reason of 'propagated_elit' via 'cb_add_reason_clause_lit'.
+// clause as a whole or literal by literal. In case propagated_elit is 0, it
+// is about an external clause via 'cb_add_external_clause' or
+// 'cb_add_external_clause_lit'. Otherwise, it is about learning the reason
+// of 'propagated_elit' via 'cb_add_reason_clause' or
+// 'cb_add_reason_clause_lit'.
 // The learned clause is simplified by the current root-level assignment
 // (i.e. root-level falsified literals are removed, root satisfied clauses
 // are skipped). Duplicate literals are removed, tauotologies are detected
@@ -475,6 +544,12 @@ void Internal::add_external_clause (int propagated_elit,
   assert (original.empty ());
   int elit = 0;
 
+  // The propagator can hand over the whole clause at once, otherwise it is
+  // read literal by literal.
+  const int *lits = 0;
+  size_t size = 0;
+  bool whole;
+
   if (propagated_elit) {
     // Propagation reason clauses are by default assumed to be forgettable
     // irredundant. In case they would be unforgettably important, the
@@ -484,9 +559,20 @@ void Internal::add_external_clause (int propagated_elit,
 #ifndef NDEBUG
     LOG ("add external reason of propagated lit: %d", propagated_elit);
 #endif
-    elit = external->propagator->cb_add_reason_clause_lit (propagated_elit);
-  } else
-    elit = external->propagator->cb_add_external_clause_lit ();
+    const uint64_t started = start_callback ();
+    whole = external->propagator->cb_add_reason_clause (propagated_elit,
+                                                        lits, size);
+    if (!whole)
+      elit =
+          external->propagator->cb_add_reason_clause_lit (propagated_elit);
+    stop_callback (stats.ext_cb.clause, started, whole ? size : elit != 0);
+  } else {
+    const uint64_t started = start_callback ();
+    whole = external->propagator->cb_add_external_clause (lits, size);
+    if (!whole)
+      elit = external->propagator->cb_add_external_clause_lit ();
+    stop_callback (stats.ext_cb.clause, started, whole ? size : elit != 0);
+  }
 
   // we need to be build a new LRAT chain if we are already in the middle of
   // the analysis (like during failed assumptions)
@@ -503,14 +589,26 @@ void Internal::add_external_clause (int propagated_elit,
   assert (!from_propagator);
   force_no_backtrack = no_backtrack;
   from_propagator = true;
-  while (elit) {
-    assert (external->is_observed[abs (elit)]);
-    external->add (elit);
-    if (propagated_elit)
-      elit =
-          external->propagator->cb_add_reason_clause_lit (propagated_elit);
-    else
-      elit = external->propagator->cb_add_external_clause_lit ();
+  if (whole) {
+    for (size_t i = 0; i < size; i++) {
+      elit = lits[i];
+      assert (elit);
+      assert (external->is_observed[abs (elit)]);
+      external->add (elit);
+    }
+    elit = 0;
+  } else {
+    while (elit) {
+      assert (external->is_observed[abs (elit)]);
+      external->add (elit);
+      const uint64_t started = start_callback ();
+      if (propagated_elit)
+        elit = external->propagator->cb_add_reason_clause_lit (
+            propagated_elit);
+      else
+        elit = external->propagator->cb_add_external_clause_lit ();
+      stop_callback (stats.ext_cb.clause, started, elit != 0);
+    }
   }
   external->add (elit);
   assert (original.empty ());
@@ -540,7 +638,7 @@ void Internal::explain_reason (int ilit, Clause *reason, int &open) {
     Flags &f = flags (other);
     if (f.seen)
       continue;
-    Var &v = var (other);
+    VarRef v = var (other);
     if (!v.level)
       continue;
     assert (val (other) < 0);
@@ -590,7 +688,7 @@ void Internal::explain_external_propagations () {
     if (!flags (lit).seen)
       continue;
     seen_lits.push_back (lit);
-    Var &v = var (lit);
+    VarRef v = var (lit);
     if (!v.level)
       continue;
     if (v.reason) {
@@ -619,7 +717,7 @@ void Internal::explain_external_propagations () {
   for (auto it = seen_lits.rbegin (); it != seen_lits.rend (); ++it) {
     const int lit = *it;
     Flags &f = flags (lit);
-    Var &v = var (lit);
+    VarRef v = var (lit);
     if (v.reason) {
       int real_level = 0;
       for (const auto &other : *v.reason) {
@@ -675,6 +773,12 @@ Clause *Internal::learn_external_reason_clause (int ilit,
   int elit = 0;
   if (!falsified_elit) {
     assert (!fixed (ilit));
+    Clause *res = cached_external_reason (ilit);
+    if (res) {
+      stats.ext_prop.eprop_reused++;
+      clause = std::move (clause_tmp);
+      return res;
+    }
     elit = externalize (ilit);
   } else
     elit = falsified_elit;
@@ -682,6 +786,13 @@ Clause *Internal::learn_external_reason_clause (int ilit,
   LOG ("ilit: %d, elit: %d", ilit, elit);
   add_external_clause (elit, no_backtrack);
 
+  if (!falsified_elit && newest_clause) {
+    const unsigned ulit = vlit (ilit);
+    if (ulit >= ext_reasons.size ())
+      ext_reasons.resize (ulit + 1, 0);
+    ext_reasons[ulit] = newest_clause;
+  }
+
 #ifndef NDEBUG
   if (!falsified_elit && newest_clause) {
     // Check if external propagation is correct wrt to the topological order
@@ -699,6 +810,70 @@ Clause *Internal::learn_external_reason_clause (int ilit,
   return newest_clause;
 }
 
+/*----------------------------------------------------------------------------*/
+//
+// Reason clauses learned for externally propagated literals are cached per
+// literal until they are collected.  If the same literal is propagated
+// again later and the cached clause is still a reason for it, i.e., all
+// its other literals are falsified before it on the trail, the clause is
+// reused instead of asking the propagator again and adding a duplicate.
+// Its watches are then moved to the propagated and the highest falsified
+// literal as in 'move_literals_to_watch' for a newly added reason.
+//
+Clause *Internal::cached_external_reason (int ilit) {
+  const unsigned ulit = vlit (ilit);
+  if (ulit >= ext_reasons.size () || !watching ())
+    return 0;
+  Clause *c = ext_reasons[ulit];
+  if (!c)
+    return 0;
+  if (c->garbage) {
+    ext_reasons[ulit] = 0;
+    return 0;
+  }
+  assert (val (ilit) > 0);
+  const int pos = var (ilit).trail;
+  bool found = false;
+  int highest = 0, highest_level = -1;
+  for (const auto other : *c) {
+    if (other == ilit) {
+      found = true;
+      continue;
+    }
+    if (val (other) >= 0)
+      return 0;
+    VarRef v = var (other);
+    if (v.trail > pos)
+      return 0;
+    if (v.level > highest_level)
+      highest = other, highest_level = v.level;
+  }
+  if (!found)
+    return 0;
+  int *lits = c->literals;
+  const int other = lits[0] == ilit ? lits[1] : lits[0];
+  if ((lits[0] != ilit && lits[1] != ilit) ||
+      var (other).level < highest_level) {
+    unwatch_clause (c);
+    for (int i = 0; i < 2; i++) {
+      const int wanted = i ? highest : ilit;
+      int j = i;
+      while (lits[j] != wanted)
+        j++;
+      swap (lits[i], lits[j]);
+    }
+    watch_clause (c);
+  }
+  LOG (c, "reusing external reason of %d", ilit);
+  return c;
+}
+
+// Clauses are deleted or moved during garbage collection and literals are
+// renumbered during 'compact', which both invalidate the cache.  Only
+// incremental moving ('move_clause') redirects cached clauses instead.
+
+void Internal::flush_external_reasons () { ext_reasons.clear (); }
+
 /*----------------------------------------------------------------------------*/
 //
 // Helper function to be able to call learn_external_reason_clause when the
@@ -858,8 +1033,10 @@ bool Internal::external_check_solution () {
 #endif
     }
 
+    const uint64_t started = start_callback ();
     bool is_consistent =
         external->propagator->cb_check_found_model (etrail);
+    stop_callback (stats.ext_cb.check, started, etrail.size ());
     stats.ext_prop.ext_cb++;
     if (is_consistent) {
       LOG ("Found solution is approved by external propagator.");
@@ -949,18 +1126,125 @@ void Internal::notify_assignments () {
     // This happens on root level, so notification about their assignment is
     // already done.
     assert (external->observed (elit) || fixed (ilit));
-    assigned.push_back (elit);
+    if (external_prop_view)
+      push_trail_view (elit);
+    else
+      assigned.push_back (elit);
   }
 
-  external->propagator->notify_assignment (assigned);
+  if (external_prop_view)
+    notify_trail_view ();
+  else {
+    const uint64_t started = start_callback ();
+    external->propagator->notify_assignment (assigned);
+    stop_callback (stats.ext_cb.notify, started, assigned.size ());
+  }
   return;
 }
 
+/*----------------------------------------------------------------------------*/
+//
+// Propagators using 'notify_trail' get a view into 'etrail', which holds
+// the notified observed literals in external form, while 'elevels' holds
+// the end of each decision level in 'etrail'.  Variables are only pushed
+// once, thus repeated notifications of root-level assignments (after
+// 'compact' or when renotifying the full trail) are ignored.  After each
+// of the functions below all literals on 'etrail' are notified, unless
+// the propagator is asleep (see 'external_prop_asleep').
+//
+void Internal::push_trail_view (int elit) {
+  const size_t eidx = abs (elit);
+  if (eidx >= etrailed.size ())
+    etrailed.resize (eidx + 1, false);
+  if (etrailed[eidx])
+    return;
+  etrailed[eidx] = true;
+  etrail.push_back (elit);
+}
+
+void Internal::update_trail_view () {
+  etrail_view.lits = etrail.data ();
+  etrail_view.size = etrail_notified;
+  etrail_view.levels = elevels.data ();
+  etrail_view.level = elevels.size ();
+}
+
+void Internal::notify_trail_view () {
+  assert (external_prop_view);
+  const size_t from = etrail_notified;
+  if (from == etrail.size ())
+    return;
+  if (external_prop_asleep ())
+    return;
+  etrail_notified = etrail.size ();
+  update_trail_view ();
+  const uint64_t started = start_callback ();
+  external->propagator->notify_trail (etrail_view, from);
+  stop_callback (stats.ext_cb.notify, started, etrail.size () - from);
+}
+
+// Propagators with an 'observed_threshold' are only called back if at
+// least that many observed variables are assigned, which (since each
+// variable is on 'etrail' at most once) is the size of 'etrail' as soon as
+// the new assignments are pushed by 'notify_assignments'.
+
+bool Internal::external_prop_asleep () const {
+  return etrail.size () < external_prop_threshold;
+}
+
+// Assignments of fixed variables which become observed are notified
+// explicitly (see 'External::add_observed_var').
+
+void Internal::notify_fixed_observed (int elit) {
+  assert (!level);
+  push_trail_view (elit);
+  notify_trail_view ();
+}
+
+/*----------------------------------------------------------------------------*/
+//
+// Every call to the external propagator is wrapped by these two functions,
+// which count the calls and literals transferred per kind of callback and
+// measure the cycles spent in them.  The time stamp counter is cheap
+// enough to be read around every callback, while the (expensive) 'external'
+// profile is only started at high profiling levels.  Callbacks can nest
+// (backtracking forced during 'cb_decide' is notified), in which case the
+// cycles of the inner callback are also counted for the outer one, but the
+// profile only covers the outermost callback.
+//
+uint64_t Internal::start_callback () {
+  if (!ext_cb_depth++)
+    START (external);
+  return cycles ();
+}
+
+void Internal::stop_callback (Stats::ExtCallback &cb, uint64_t started,
+                              size_t lits) {
+  const uint64_t delta = cycles () - started;
+  assert (ext_cb_depth > 0);
+  if (!--ext_cb_depth)
+    STOP (external);
+  cb.calls++;
+  cb.lits += lits;
+  cb.cycles += delta;
+  int bucket = 0;
+  for (uint64_t c = delta >> 2; c && bucket + 1 < Stats::ext_cb_buckets;
+       c >>= 2)
+    bucket++;
+  cb.histogram[bucket]++;
+}
+
 /*----------------------------------------------------------------------------*/
 
 void Internal::connect_propagator () {
   if (level)
     backtrack ();
+  etrail.clear ();
+  elevels.clear ();
+  etrailed.clear ();
+  etrail_notified = 0;
+  update_trail_view ();
+  flush_external_reasons ();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -970,7 +1254,15 @@ void Internal::connect_propagator () {
 void Internal::notify_decision () {
   if (!external_prop || external_prop_is_lazy || private_steps)
     return;
+  if (external_prop_view) {
+    notify_assignments ();
+    elevels.push_back (etrail.size ());
+    update_trail_view ();
+    return;
+  }
+  const uint64_t started = start_callback ();
   external->propagator->notify_new_decision_level ();
+  stop_callback (stats.ext_cb.notify, started, 0);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -980,7 +1272,26 @@ void Internal::notify_decision () {
 void Internal::notify_backtrack (size_t new_level) {
   if (!external_prop || external_prop_is_lazy || private_steps)
     return;
-  external->propagator->notify_backtrack (new_level);
+  // Sleeping propagators are not told about backtracking below literals
+  // which were not notified.
+  if (!external_prop_threshold || (new_level < elevels.size () &&
+                                   elevels[new_level] < etrail_notified)) {
+    const uint64_t started = start_callback ();
+    external->propagator->notify_backtrack (new_level);
+    stop_callback (stats.ext_cb.notify, started, 0);
+  }
+  if (!external_prop_view || new_level >= elevels.size ())
+    return;
+  // The propagator can still read the literals of the backtracked levels
+  // through the view during 'notify_backtrack' above.
+  const size_t end = elevels[new_level];
+  for (size_t i = end; i < etrail.size (); i++)
+    etrailed[abs (etrail[i])] = false;
+  etrail.resize (end);
+  elevels.resize (new_level);
+  if (etrail_notified > end)
+    etrail_notified = end;
+  update_trail_view ();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -995,9 +1306,24 @@ int Internal::ask_decision () {
   assert (!unsat);
   assert (!conflict);
   notify_assignments ();
+
+  // Prioritized observed variables are decided without asking, even if
+  // the propagator is asleep, since they do not need a callback.
+  //
+  const int prioritized = next_prioritized_variable ();
+  if (prioritized) {
+    stats.ext_prop.eprio_dec++;
+    const bool target = (opts.target > 1 || (stable && opts.target));
+    return decide_phase (prioritized, target);
+  }
+
   int level_before = level;
+  if (external_prop_asleep ())
+    return 0;
   forced_backt_allowed = true;
+  const uint64_t started = start_callback ();
   int elit = external->propagator->cb_decide ();
+  stop_callback (stats.ext_cb.decide, started, elit != 0);
   forced_backt_allowed = false;
   stats.ext_prop.ext_cb++;
 
@@ -1213,7 +1539,7 @@ void Internal::get_all_fixed_literals (std::vector<int> &fixed_lits) {
     if (ilit) {
       Flags &f = flags (ilit);
       if (f.status == Flags::FIXED) {
-        fixed_lits.push_back (vals[abs (ilit)] * eidx);
+        fixed_lits.push_back (val (abs (ilit)) * eidx);
       }
     }
   }
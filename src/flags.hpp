@@ -49,10 +49,16 @@ struct Flags { // Variable flags.
 
   unsigned char status : 3;
 
+  // Set while the reference count in 'relevanttab' is positive, which
+  // allows to test observed variables of the trail next to the other flags.
+  //
+  bool observed : 1;
+
   // Initialized explicitly in 'Internal::init' through this function.
   //
   Flags () {
     seen = keep = poison = removable = shrinkable = added = false;
+    observed = false;
     subsume = elim = ternary = true;
     block = 3u;
     skip = assumed = failed = decompose = 0;
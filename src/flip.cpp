@@ -21,7 +21,7 @@ bool Internal::flip (int lit) {
   LOG ("trying to flip %d", lit);
 
   const int idx = vidx (lit);
-  const signed char original_value = vals[idx];
+  const signed char original_value = val (idx);
   assert (original_value);
   lit = original_value < 0 ? -idx : idx;
   assert (val (lit) > 0);
@@ -64,20 +64,21 @@ bool Internal::flip (int lit) {
       if (w.binary ())
         continue;
 
-      if (w.clause->garbage) {
+      Clause *c = watched_clause (w);
+      if (c->garbage) {
         j--;
         continue;
       }
 
-      literal_iterator lits = w.clause->begin ();
+      literal_iterator lits = c->begin ();
 
       const int other = lits[0] ^ lits[1] ^ lit;
       const signed char u = val (other);
       if (u > 0)
         continue;
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
+      const int size = c->size;
+      const literal_iterator middle = lits + c->saved_pos ();
       const const_literal_iterator end = lits + size;
       literal_iterator k = middle;
 
@@ -87,7 +88,7 @@ bool Internal::flip (int lit) {
         k++;
       if (v < 0) {
         k = lits + 2;
-        assert (w.clause->pos <= size);
+        assert (c->saved_pos () <= size);
         while (k != middle && (v = val (r = *k)) < 0)
           k++;
       }
@@ -98,10 +99,10 @@ bool Internal::flip (int lit) {
       }
 
       assert (v > 0);
-      assert (lits + 2 <= k), assert (k <= w.clause->end ());
-      w.clause->pos = k - lits;
+      assert (lits + 2 <= k), assert (k <= c->end ());
+      c->save_pos (k - lits);
       lits[0] = other, lits[1] = r, *k = lit;
-      watch_literal (r, lit, w.clause);
+      watch_literal (r, lit, c);
       j--;
     }
 
@@ -123,7 +124,7 @@ bool Internal::flip (int lit) {
   if (res) {
 
     const int idx = vidx (lit);
-    const signed char original_value = vals[idx];
+    const signed char original_value = val (idx);
     assert (original_value);
     lit = original_value < 0 ? -idx : idx;
     assert (val (lit) > 0);
@@ -134,7 +135,7 @@ bool Internal::flip (int lit) {
     assert (val (-lit) > 0);
     assert (val (lit) < 0);
 
-    Var &v = var (idx);
+    VarRef v = var (idx);
     assert (trail[v.trail] == lit);
     trail[v.trail] = -lit;
     if (opts.ilb) {
@@ -172,7 +173,7 @@ bool Internal::flippable (int lit) {
   LOG ("checking whether %d is flippable", lit);
 
   const int idx = vidx (lit);
-  const signed char original_value = vals[idx];
+  const signed char original_value = val (idx);
   assert (original_value);
   lit = original_value < 0 ? -idx : idx;
   assert (val (lit) > 0);
@@ -200,10 +201,11 @@ bool Internal::flippable (int lit) {
       break;
     }
 
-    if (w.clause->garbage)
+    Clause *c = watched_clause (w);
+    if (c->garbage)
       continue;
 
-    literal_iterator lits = w.clause->begin ();
+    literal_iterator lits = c->begin ();
 
     const int other = lits[0] ^ lits[1] ^ lit;
     const signed char u = val (other);
@@ -212,8 +214,8 @@ bool Internal::flippable (int lit) {
       continue;
     }
 
-    const int size = w.clause->size;
-    const literal_iterator middle = lits + w.clause->pos;
+    const int size = c->size;
+    const literal_iterator middle = lits + c->saved_pos ();
     const const_literal_iterator end = lits + size;
     literal_iterator k = middle;
 
@@ -223,7 +225,7 @@ bool Internal::flippable (int lit) {
       k++;
     if (v < 0) {
       k = lits + 2;
-      assert (w.clause->pos <= size);
+      assert (c->saved_pos () <= size);
       while (k != middle && (v = val (r = *k)) < 0)
         k++;
     }
@@ -235,8 +237,8 @@ bool Internal::flippable (int lit) {
 
     assert (v > 0);
     assert (lits + 2 <= k);
-    assert (k <= w.clause->end ());
-    w.clause->pos = k - lits;
+    assert (k <= c->end ());
+    c->save_pos (k - lits);
     i->blit = r;
   }
 
@@ -8,7 +8,8 @@ FratTracer::FratTracer (Internal *i, File *f, bool b, bool a)
     : internal (i), file (f), binary (b), with_antecedents (a)
 #ifndef QUIET
       ,
-      added (0), deleted (0), finalized (0), original (0)
+      added (0), deleted (0), finalized (0), original (0),
+      trusted (0)
 #endif
 {
   (void) internal;
@@ -85,6 +86,31 @@ void FratTracer::frat_add_original_clause (uint64_t id,
     file->put ("0\n");
 }
 
+// Trusted clauses are written as 't ID LITS 0' steps, which introduce a
+// clause like an original step but without requiring it to be part of the
+// input formula.
+
+void FratTracer::frat_add_trusted_clause (uint64_t id,
+                                          const vector<int> &clause) {
+  if (binary)
+    file->put ('t');
+  else
+    file->put ("t ");
+  if (binary)
+    put_binary_id (id);
+  else
+    file->put (id), file->put ("  ");
+  for (const auto &external_lit : clause)
+    if (binary)
+      put_binary_lit (external_lit);
+    else
+      file->put (external_lit), file->put (' ');
+  if (binary)
+    put_binary_zero ();
+  else
+    file->put ("0\n");
+}
+
 void FratTracer::frat_add_derived_clause (uint64_t id,
                                           const vector<int> &clause) {
   if (binary)
@@ -189,6 +215,17 @@ void FratTracer::add_original_clause (uint64_t id, bool,
   frat_add_original_clause (id, clause);
 }
 
+void FratTracer::add_trusted_original_clause (uint64_t id,
+                                              const vector<int> &clause) {
+  if (file->closed ())
+    return;
+  LOG ("FRAT TRACER tracing addition of trusted clause");
+  frat_add_trusted_clause (id, clause);
+#ifndef QUIET
+  trusted++;
+#endif
+}
+
 void FratTracer::add_derived_clause (uint64_t id, bool,
                                      const vector<int> &clause,
                                      const vector<uint64_t> &chain) {
@@ -230,9 +267,11 @@ bool FratTracer::closed () { return file->closed (); }
 
 void FratTracer::print_statistics () {
   uint64_t bytes = file->bytes ();
-  uint64_t total = original + added + deleted + finalized;
+  uint64_t total = original + trusted + added + deleted + finalized;
   MSG ("FRAT %" PRId64 " original clauses %.2f%%", original,
        percent (original, total));
+  MSG ("FRAT %" PRId64 " trusted clauses %.2f%%", trusted,
+       percent (trusted, total));
   MSG ("FRAT %" PRId64 " added clauses %.2f%%", added,
        percent (added, total));
   MSG ("FRAT %" PRId64 " deleted clauses %.2f%%", deleted,
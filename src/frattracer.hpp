@@ -12,7 +12,7 @@ class FratTracer : public FileTracer {
 
 #ifndef QUIET
   int64_t added, deleted;
-  int64_t finalized, original;
+  int64_t finalized, original, trusted;
 #endif
 
   vector<uint64_t> delete_ids;
@@ -23,6 +23,7 @@ class FratTracer : public FileTracer {
 
   // support FRAT
   void frat_add_original_clause (uint64_t, const vector<int> &);
+  void frat_add_trusted_clause (uint64_t, const vector<int> &);
   void frat_add_derived_clause (uint64_t, const vector<int> &);
   void frat_add_derived_clause (uint64_t, const vector<int> &,
                                 const vector<uint64_t> &);
@@ -43,6 +44,8 @@ public:
   void add_derived_clause (uint64_t, bool, const vector<int> &,
                            const vector<uint64_t> &) override;
 
+  void add_trusted_original_clause (uint64_t, const vector<int> &) override;
+
   void delete_clause (uint64_t, bool, const vector<int> &) override;
 
   void finalize_clause (uint64_t, const vector<int> &) override;
@@ -0,0 +1,394 @@
+#include "graph.hpp"
+#include "unembeddable_graphs.h"
+#include <iostream>
+
+CanonicalChecker::CanonicalChecker (int vertices, long cutoff) : k(vertices), cutoff(cutoff) {
+    perm.resize(k);
+    used.resize(k);
+}
+
+int CanonicalChecker::edge (int i, int j) const {
+    assert (i != j);
+    if (i > j) std::swap(i, j);
+    return j * (j - 1) / 2 + i;
+}
+
+int CanonicalChecker::value (int i, int j) const {
+    return assign[edge(i, j)];
+}
+
+// The currently true literal of an assigned edge variable.
+
+int CanonicalChecker::literal (int i, int j) const {
+    const int e = edge(i, j);
+    assert (assign[e] != l_Undef);
+    return (e + 1) * (assign[e] == l_True ? 1 : -1);
+}
+
+// Compare column 'j' of the adjacency matrix with column 'j' of the matrix
+// permuted by 'perm'.  Returns '1' if the permuted matrix is smaller for
+// every extension of the current assignment, '0' if both columns are
+// equal, and '-1' if the permuted matrix is larger or the comparison is
+// undetermined.  Literals which are needed to justify the result are
+// pushed on 'compared'.
+
+int CanonicalChecker::compare_column (int j) {
+    const int pj = perm[j];
+    for (int i = 0; i < j; i++) {
+        const int pi = perm[i];
+        if (edge(i, j) == edge(pi, pj)) continue;
+        const int a = value(i, j), b = value(pi, pj);
+        if (a == l_Undef || b == l_Undef) return -1;
+        if (a == l_False && b == l_True) return -1;
+        compared.push_back(literal(i, j));
+        compared.push_back(literal(pi, pj));
+        if (a == l_True && b == l_False) return 1;
+    }
+    return 0;
+}
+
+// Depth-first search for a permutation witnessing that the current partial
+// adjacency matrix is not lexicographically minimal.  The image of vertex
+// 'j' is chosen after those of vertices '0' to 'j-1', which allows to
+// compare column 'j' as soon as it is fully permuted.  The search of
+// partial assignments gives up after 'cutoff' steps, while for complete
+// assignments it has to be exhaustive, since otherwise a non-canonical
+// graph would be counted.
+
+bool CanonicalChecker::find_smaller (int j) {
+    if (j == k) return false;
+    for (int v = 0; v < k; v++) {
+        if (used[v]) continue;
+        if (!complete && ++steps > cutoff) return false;
+        perm[j] = v;
+        used[v] = true;
+        const size_t before = compared.size();
+        const int res = compare_column(j);
+        if (res > 0) return true;
+        if (!res && find_smaller(j + 1)) return true;
+        compared.resize(before);
+        used[v] = false;
+    }
+    return false;
+}
+
+// Returns 'false' and the clause refuting 'assignment' if it can not be
+// extended to a canonical one.  If 'complete' is set all variables are
+// assigned and the check is exact.
+
+bool CanonicalChecker::check (const char * assignment, std::vector<int> & clause, bool complete) {
+    assign = assignment;
+    this->complete = complete;
+    steps = 0;
+    compared.clear();
+    used.assign(k, false);
+    if (!find_smaller(0)) return true;
+    clause.clear();
+    for (int lit : compared) clause.push_back(-lit);
+    std::sort(clause.begin(), clause.end());
+    clause.erase(std::unique(clause.begin(), clause.end()), clause.end());
+    return false;
+}
+
+/*------------------------------------------------------------------------*/
+
+GraphSearch::GraphSearch(CaDiCaL::Solver * s, int vertices, bool canonical, bool unembeddable, bool only_neg, FILE * solfile, bool can_forget, bool async, long cutoff)
+    : ExhaustiveSearch(s, vertices * (vertices - 1) / 2, only_neg, solfile, can_forget, true),
+      k(vertices), canonical(canonical), unembeddable(unembeddable), checker(vertices, cutoff), async(canonical && async) {
+    assert (vertices > 1);
+    taken.resize(k);
+    if (canonical) {
+        std::cout << "c Checking canonicity of graphs on " << k << " vertices";
+        if (this->async) std::cout << " (asynchronously)";
+        std::cout << std::endl;
+    }
+    if (unembeddable) {
+        init_patterns();
+        std::cout << "c Blocking " << patterns.size() << " minimal unembeddable subgraphs" << std::endl;
+        // Graphs with less vertices than every pattern can not contain any
+        // of them, thus neither collect pending edges nor match them.
+        if (patterns.empty()) this->unembeddable = false;
+    }
+    // Fixed edges are notified while observing them in the constructor of
+    // 'ExhaustiveSearch', where 'notify_trail' of this class is not called.
+    dirty = num_assign > 0;
+    for (int e = 0; this->unembeddable && e < n; e++) {
+        if (assign[e] == l_True) pending.push_back(e);
+    }
+    if (this->async) helper = std::thread(&GraphSearch::run_helper, this, cutoff);
+}
+
+GraphSearch::~GraphSearch () {
+    if (async) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_one();
+        helper.join();
+        std::cout << "c Asynchronous canonicity checks: " << async_checks << " (" << async_conflicts << " conflicts)" << std::endl;
+    }
+    if (canonical) {
+        std::cout << "c Canonicity checks: " << canonical_checks << " (" << canonical_conflicts << " conflicts)" << std::endl;
+    }
+    if (unembeddable) {
+        std::cout << "c Subgraph checks: " << subgraph_checks << " (" << subgraph_conflicts << " conflicts)" << std::endl;
+    }
+}
+
+int GraphSearch::edge (int i, int j) const {
+    assert (i != j);
+    if (i > j) std::swap(i, j);
+    return j * (j - 1) / 2 + i;
+}
+
+int GraphSearch::value (int i, int j) const {
+    return assign[edge(i, j)];
+}
+
+void GraphSearch::notify_trail (const CaDiCaL::ExternalTrail & view, size_t from) {
+    ExhaustiveSearch::notify_trail(view, from);
+    dirty = true;
+    if (!unembeddable) return;
+    for (size_t i = from; i < view.size; i++) {
+        const int lit = view.lits[i];
+        if (lit > 0 && lit <= n) pending.push_back(lit - 1);
+    }
+}
+
+bool GraphSearch::check_canonical () {
+    canonical_checks++;
+    return checker.check(assign, reason, num_assign == n);
+}
+
+// Publish a copy of the current partial assignment for the helper thread,
+// replacing an older snapshot if the helper did not take that one yet.
+
+void GraphSearch::publish () {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        snapshot.assign(assign, assign + n);
+        published = true;
+    }
+    wake.notify_one();
+}
+
+// The helper thread checks the latest snapshot with its own checker.  The
+// refuting clauses only depend on the snapshot and stay valid afterwards.
+
+void GraphSearch::run_helper (long cutoff) {
+    CanonicalChecker own(k, cutoff);
+    std::vector<char> current;
+    std::vector<int> clause;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wake.wait(lock, [this] { return stop || published; });
+        if (stop) break;
+        current.swap(snapshot);
+        published = false;
+        lock.unlock();
+        const bool ok = own.check(current.data(), clause);
+        lock.lock();
+        async_checks++;
+        if (!ok) {
+            async_conflicts++;
+            found.push_back(clause);
+        }
+    }
+}
+
+// Take one clause found by the helper thread (if any) into 'reason'.
+
+bool GraphSearch::take_found () {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (found.empty()) return false;
+    reason.swap(found.back());
+    found.pop_back();
+    return true;
+}
+
+// A non-canonical partial assignment is reported as the propagation of a
+// falsified literal of the reason clause, which lets the solver ask for
+// the reason right away and start conflict analysis.
+
+int GraphSearch::cb_propagate () {
+    if (!canonical || !dirty) return 0;
+    if (async && num_assign < n) {
+        dirty = false;
+        publish();
+        return 0;
+    }
+    dirty = false;
+    if (check_canonical()) return 0;
+    canonical_conflicts++;
+    reason_pos = 0;
+    solver->add_trusted_clause(reason);
+    return reason[0];
+}
+
+int GraphSearch::cb_add_reason_clause_lit (int plit) {
+    (void)plit;
+    if (reason_pos < reason.size()) return reason[reason_pos++];
+    reason_pos = 0;
+    return 0;
+}
+
+bool GraphSearch::cb_add_reason_clause (int plit, const int *& lits, size_t & size) {
+    (void)plit;
+    lits = reason.data();
+    size = reason.size();
+    return true;
+}
+
+// Complete assignments might reach the solution check without another call
+// to 'cb_propagate', thus canonicity has to be checked here too before the
+// solution is counted and blocked.  Forbidden subgraphs are only matched
+// here, since they are reported as blocking clauses, and so are the clauses
+// found asynchronously by the helper thread.
+
+bool GraphSearch::cb_has_external_clause (bool& is_forgettable) {
+    if (async && take_found()) {
+        is_forgettable = can_forget;
+        solver->add_trusted_clause(reason);
+        new_clauses.push_back(reason);
+        return true;
+    }
+    if (unembeddable && find_forbidden()) {
+        subgraph_conflicts++;
+        is_forgettable = can_forget;
+        solver->add_trusted_clause(reason);
+        new_clauses.push_back(reason);
+        return true;
+    }
+    if (canonical && num_assign == n && dirty) {
+        dirty = false;
+        if (!check_canonical()) {
+            canonical_conflicts++;
+            is_forgettable = can_forget;
+            solver->add_trusted_clause(reason);
+            new_clauses.push_back(reason);
+            return true;
+        }
+    }
+    return ExhaustiveSearch::cb_has_external_clause(is_forgettable);
+}
+
+// Decode the rows of 'mus' into edge lists and adjacency lists.  The rows
+// are given in the same column by column order as the edge variables.
+
+void GraphSearch::init_patterns () {
+    const int rows = sizeof mus / sizeof mus[0];
+    const int size = sizeof mus[0] / sizeof mus[0][0];
+    for (int r = 0; r < rows; r++) {
+        Pattern p;
+        p.vertices = 0;
+        for (int j = 1, e = 0; e < size; j++) {
+            for (int i = 0; i < j && e < size; i++, e++) {
+                if (!mus[r][e]) continue;
+                p.edges.push_back(std::make_pair(i, j));
+                p.vertices = j + 1;
+            }
+        }
+        // Patterns with more vertices than the graph can never match.
+        if (p.vertices > k) continue;
+        p.adjacent.resize(p.vertices);
+        for (const auto & uv : p.edges) {
+            p.adjacent[uv.first].push_back(uv.second);
+            p.adjacent[uv.second].push_back(uv.first);
+        }
+        patterns.push_back(p);
+    }
+}
+
+// Map the pattern vertex 'order[i]' to a graph vertex adjacent (with true
+// edges) to the images of all its already mapped pattern neighbours.
+
+bool GraphSearch::extend (const Pattern & p, size_t i) {
+    if (i == order.size()) return true;
+    const int w = order[i];
+    const int anchor = parent[w] < 0 ? -1 : image[parent[w]];
+    for (int c = 0; c < k; c++) {
+        if (taken[c]) continue;
+        if (anchor >= 0 && value(anchor, c) != l_True) continue;
+        bool ok = true;
+        for (int y : p.adjacent[w]) {
+            if (image[y] < 0) continue;
+            if (value(c, image[y]) != l_True) { ok = false; break; }
+        }
+        if (!ok) continue;
+        image[w] = c;
+        taken[c] = true;
+        if (extend(p, i + 1)) return true;
+        taken[c] = false;
+        image[w] = -1;
+    }
+    return false;
+}
+
+// Try to embed the pattern with its edge '{u,v}' mapped to the true graph
+// edge '{a,b}'.  Remaining pattern vertices are mapped in breadth-first
+// order starting from 'u' and 'v' such that each of them has an already
+// mapped neighbour which restricts the candidates.
+
+bool GraphSearch::embed (const Pattern & p, int u, int a, int v, int b) {
+    image.assign(p.vertices, -1);
+    parent.assign(p.vertices, -1);
+    taken.assign(k, false);
+    image[u] = a, image[v] = b;
+    taken[a] = taken[b] = true;
+    order.clear();
+    queue.clear();
+    queued.assign(p.vertices, false);
+    queue.push_back(u), queue.push_back(v);
+    queued[u] = queued[v] = true;
+    for (size_t head = 0; head < queue.size(); head++) {
+        const int x = queue[head];
+        for (int y : p.adjacent[x]) {
+            if (queued[y]) continue;
+            queued[y] = true;
+            parent[y] = x;
+            queue.push_back(y);
+            order.push_back(y);
+        }
+    }
+    for (int x = 0; x < p.vertices; x++) {
+        if (!queued[x]) order.push_back(x);
+    }
+    if (!extend(p, 0)) return false;
+    reason.clear();
+    for (const auto & xy : p.edges) {
+        reason.push_back(-(edge(image[xy.first], image[xy.second]) + 1));
+    }
+    return true;
+}
+
+// Search for a forbidden subgraph which uses the true edge 'e'.  Every
+// other edge of such a subgraph was assigned before, thus checking only
+// the recently assigned edges finds all matches.
+
+bool GraphSearch::contains_forbidden (int e) {
+    subgraph_checks++;
+    int a = 1;
+    while (a * (a + 1) / 2 <= e) a++;
+    const int b = e - a * (a - 1) / 2;
+    assert (edge(a, b) == e);
+    for (const auto & p : patterns) {
+        for (const auto & uv : p.edges) {
+            if (embed(p, uv.first, a, uv.second, b)) return true;
+            if (embed(p, uv.first, b, uv.second, a)) return true;
+        }
+    }
+    return false;
+}
+
+// An edge stays pending if a match was found, since after backtracking it
+// might still be assigned and part of other matches.
+
+bool GraphSearch::find_forbidden () {
+    while (!pending.empty()) {
+        const int e = pending.back();
+        if (assign[e] == l_True && contains_forbidden(e)) return true;
+        pending.pop_back();
+    }
+    return false;
+}
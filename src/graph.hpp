@@ -0,0 +1,132 @@
+#ifndef _graph_hpp_INCLUDED
+#define _graph_hpp_INCLUDED
+
+#include "exhaustive.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Exhaustive search over graphs given by their upper-triangular adjacency
+// matrix.  The first 'k(k-1)/2' variables are the edge variables, ordered
+// column by column, i.e., the edge '{i,j}' with 'i < j' is the variable
+// 'j(j-1)/2 + i + 1'.  This is the same order as used for the minimal
+// unembeddable subgraphs in 'unembeddable_graphs.h' and has the property
+// that the edges of the first 'j' vertices form a prefix.
+//
+// On top of the blocking clauses of 'ExhaustiveSearch' this propagator
+// checks that the partial adjacency matrix is lexicographically minimal
+// under vertex permutations (as in SAT modulo symmetries).  If a
+// permutation is found which makes the matrix smaller for every extension
+// of the current partial assignment, a conflict is raised through
+// 'cb_propagate' and the reason clause consists of the negation of those
+// edge literals which were compared before the first difference.  Thus
+// only canonical representatives of each isomorphism class are counted.
+//
+// Canonicity checks of partial assignments can be expensive and optionally
+// run asynchronously on a helper thread, while the solver keeps searching.
+// The clauses found by the helper are sound independently of the current
+// assignment and are added as external clauses at the next poll, which
+// triggers backjumping if they are falsified by then.  Complete
+// assignments are always checked synchronously before being counted.
+//
+// Further, graphs containing one of the minimal unembeddable subgraphs
+// from 'unembeddable_graphs.h' can be blocked.  Edges which became true
+// are collected in 'pending' and matching is incremental in the sense
+// that only embeddings which use the most recently assigned edges are
+// searched for.  Every fully matched subgraph yields a blocking clause
+// (the negation of its edges), which is traced as trusted clause too.
+
+// The canonicity check on its own, working on a given partial assignment
+// of the edge variables, such that it can also run on a helper thread.
+
+class CanonicalChecker {
+
+    int k;                          // number of vertices
+    long cutoff;                    // permutation search limit per check
+    const char * assign = 0;        // checked assignment
+    std::vector<int> perm;          // partial permutation of vertices
+    std::vector<bool> used;         // vertices already in 'perm'
+    std::vector<int> compared;      // true edge literals compared so far
+    long steps = 0;                 // permutation search steps this check
+    bool complete = false;          // 'assign' is complete, ignore 'cutoff'
+
+    int edge (int i, int j) const;
+    int value (int i, int j) const;
+    int literal (int i, int j) const;
+    int compare_column (int j);
+    bool find_smaller (int j);
+
+public:
+    CanonicalChecker (int vertices, long cutoff);
+    bool check (const char * assignment, std::vector<int> & clause, bool complete = false);
+};
+
+class GraphSearch : public ExhaustiveSearch {
+
+    struct Pattern {
+        int vertices;
+        std::vector<std::pair<int, int>> edges;
+        std::vector<std::vector<int>> adjacent;
+    };
+
+    int k = 0;                      // number of vertices
+    bool canonical;                 // check canonicity
+    bool unembeddable;              // block unembeddable subgraphs
+    bool dirty = false;             // assignment changed since last check
+    CanonicalChecker checker;
+    std::vector<int> reason;        // pending conflict clause
+    size_t reason_pos = 0;          // next literal of 'reason' to return
+    long canonical_checks = 0;
+    long canonical_conflicts = 0;
+
+    // Partial assignments are checked asynchronously on a helper thread if
+    // 'async' is set.  The latest snapshot of the assignment is published
+    // in 'snapshot' and the clauses found by the helper are collected in
+    // 'found', which are both protected by 'mutex'.
+    //
+    bool async;
+    std::thread helper;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<char> snapshot;
+    bool published = false;         // 'snapshot' not yet taken by helper
+    bool stop = false;              // helper should terminate
+    std::vector<std::vector<int>> found;
+    long async_checks = 0;
+    long async_conflicts = 0;
+
+    std::vector<Pattern> patterns;  // minimal unembeddable subgraphs
+    std::vector<int> pending;       // recently assigned true edges
+    std::vector<int> image;         // pattern vertex to graph vertex
+    std::vector<int> parent;        // mapped pattern neighbour
+    std::vector<int> order;         // pattern vertices in mapping order
+    std::vector<int> queue;         // breadth-first queue of 'embed'
+    std::vector<bool> queued;       // pattern vertices in 'queue'
+    std::vector<bool> taken;        // graph vertices in 'image'
+    long subgraph_checks = 0;
+    long subgraph_conflicts = 0;
+
+    int edge (int i, int j) const;
+    int value (int i, int j) const;
+    bool check_canonical ();
+    void publish ();
+    void run_helper (long cutoff);
+    bool take_found ();
+    void init_patterns ();
+    bool extend (const Pattern & p, size_t i);
+    bool embed (const Pattern & p, int u, int a, int v, int b);
+    bool contains_forbidden (int e);
+    bool find_forbidden ();
+
+public:
+    GraphSearch(CaDiCaL::Solver * s, int vertices, bool canonical, bool unembeddable, bool only_neg, FILE * solfile, bool can_forget, bool async = false, long cutoff = 20000);
+    ~GraphSearch ();
+    void notify_trail (const CaDiCaL::ExternalTrail & view, size_t from);
+    bool cb_has_external_clause (bool& is_forgettable);
+    int cb_propagate ();
+    int cb_add_reason_clause_lit (int plit);
+    bool cb_add_reason_clause (int plit, const int *& lits, size_t & size);
+};
+
+#endif
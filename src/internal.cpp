@@ -11,22 +11,34 @@ Internal::Internal ()
       protected_reasons (false), force_saved_phase (false),
       searching_lucky_phases (false), stable (false), reported (false),
       external_prop (false), did_external_prop (false),
-      external_prop_is_lazy (true), forced_backt_allowed (false),
+      external_prop_is_lazy (true), external_prop_view (false),
+      external_prop_threshold (0), forced_backt_allowed (false),
       private_steps (false), rephased (0), vsize (0), max_var (0),
       clause_id (0), original_id (0), reserved_ids (0), conflict_id (0),
-      concluded (false), lrat (false), frat (false), level (0), vals (0),
-      score_inc (1.0), scores (this), conflict (0), ignore (0),
+      concluded (false), lrat (false), frat (false), level (0),
+#ifndef COLOCATE
+      vals (0),
+#endif
+      priority_unassigned (0), score_inc (1.0), scores (this),
+      bintab_valid (false), conflict (0), ignore (0),
       external_reason (&external_reason_clause), newest_clause (0),
       force_no_backtrack (false), from_propagator (false),
       ext_clause_forgettable (false), tainted_literal (0), notified (0),
-      probe_reason (0), propagated (0), propagated2 (0), propergated (0),
+      ext_batch_lit (0), etrail_view (), etrail_notified (0),
+      ext_cb_depth (0), probe_reason (0), propagated (0), propagated2 (0),
+      propergated (0),
       best_assigned (0), target_assigned (0), no_conflict_until (0),
       unsat_constraint (false), marked_failed (true), num_assigned (0),
-      proof (0), lratbuilder (0), opts (this),
+      moving_next (0), moving_end (0), proof (0), lratbuilder (0),
+      opts (this),
 #ifndef QUIET
       profiles (this), force_phase_messages (false),
 #endif
-      arena (this), prefix ("c "), internal (this), external (0),
+      arena (this),
+#ifdef WATCHPOOL
+      wpool (this),
+#endif
+      prefix ("c "), internal (this), external (0),
       termination_forced (false), vars (this->max_var),
       lits (this->max_var) {
   control.push_back (Level (0, 0));
@@ -69,10 +81,12 @@ Internal::~Internal () {
     delete filetracer;
   for (auto &stattracer : stat_tracers)
     delete stattracer;
+#ifndef COLOCATE
   if (vals) {
     vals -= vsize;
     delete[] vals;
   }
+#endif
 }
 
 /*------------------------------------------------------------------------*/
@@ -93,12 +107,18 @@ Internal::~Internal () {
 // by static analyzers though.  Clang with '--analyze' thought that this
 // idiom would generate a memory leak thus we use the following dummy.
 
+#ifndef COLOCATE
+
 static signed char *ignore_clang_analyze_memory_leak_warning;
 
 void Internal::enlarge_vals (size_t new_vsize) {
   signed char *new_vals;
-  const size_t bytes = 2u * new_vsize;
+  size_t bytes = 2u * new_vsize;
+#ifdef SIMD_PADDING
+  bytes += SIMD_PADDING;
+#endif
   new_vals = new signed char[bytes]; // g++-4.8 does not like ... { 0 };
+  huge_pages (new_vals, bytes);
   memset (new_vals, 0, bytes);
   ignore_clang_analyze_memory_leak_warning = new_vals;
   new_vals += new_vsize;
@@ -112,6 +132,8 @@ void Internal::enlarge_vals (size_t new_vsize) {
   vals = new_vals;
 }
 
+#endif
+
 /*------------------------------------------------------------------------*/
 
 template <class T>
@@ -129,6 +151,17 @@ template <class T> static void enlarge_zero (vector<T> &v, size_t N) {
   enlarge_init (v, N, (const T &) 0);
 }
 
+// Reserves the new capacity of hot tables up-front in order to advise
+// huge pages before most of the new memory is touched.
+
+template <class T>
+static void enlarge_huge (Internal *internal, vector<T> &v, size_t N) {
+  if (!internal->opts.hugepages || v.capacity () >= N)
+    return;
+  v.reserve (N);
+  internal->huge_pages (v);
+}
+
 /*------------------------------------------------------------------------*/
 
 void Internal::enlarge (int new_max_var) {
@@ -141,16 +174,30 @@ void Internal::enlarge (int new_max_var) {
   // Ordered in the size of allocated memory (larger block first).
   if (lrat || frat)
     enlarge_zero (unit_clauses_idx, 2 * new_vsize);
-  enlarge_only (wtab, 2 * new_vsize);
+  enlarge_huge (this, wtab, 2 * new_vsize);
+  enlarge_init (wtab, 2 * new_vsize, empty_watches ());
+  bintab_valid = false;
+#ifndef COLOCATE
+  enlarge_huge (this, vtab, new_vsize);
   enlarge_only (vtab, new_vsize);
+#else
+  enlarge_huge (this, atab, new_vsize);
+  enlarge_only (atab, new_vsize);
+  enlarge_huge (this, rtab, new_vsize);
+  enlarge_only (rtab, new_vsize);
+#endif
   enlarge_zero (parents, new_vsize);
   enlarge_only (links, new_vsize);
   enlarge_zero (btab, new_vsize);
   enlarge_zero (gtab, new_vsize);
+  enlarge_huge (this, stab, new_vsize);
   enlarge_zero (stab, new_vsize);
   enlarge_init (ptab, 2 * new_vsize, -1);
+  enlarge_zero (priotab, new_vsize);
   enlarge_only (ftab, new_vsize);
+#ifndef COLOCATE
   enlarge_vals (new_vsize);
+#endif
   vsize = new_vsize;
   if (external)
     enlarge_zero (relevanttab, new_vsize);
@@ -174,10 +221,15 @@ void Internal::init_vars (int new_max_var) {
   if ((size_t) new_max_var >= vsize)
     enlarge (new_max_var);
 #ifndef NDEBUG
+#ifndef COLOCATE
   for (int64_t i = -new_max_var; i < -max_var; i++)
     assert (!vals[i]);
   for (unsigned i = max_var + 1; i <= (unsigned) new_max_var; i++)
     assert (!vals[i]), assert (!btab[i]), assert (!gtab[i]);
+#else
+  for (unsigned i = max_var + 1; i <= (unsigned) new_max_var; i++)
+    assert (!atab[i].value), assert (!btab[i]), assert (!gtab[i]);
+#endif
   for (uint64_t i = 2 * ((uint64_t) max_var + 1);
        i <= 2 * (uint64_t) new_max_var + 1; i++)
     assert (ptab[i] == -1);
@@ -297,6 +349,8 @@ int Internal::cdcl_loop_with_inprocessing () {
       break;                               // decision or conflict limit
     else if (terminated_asynchronously ()) // externally terminated
       break;
+    else if (moving ())
+      move_clauses (); // move clauses incrementally
     else if (restarting ())
       restart (); // restart by backtracking
     else if (rephasing ())
@@ -317,6 +371,9 @@ int Internal::cdcl_loop_with_inprocessing () {
       res = decide (); // next decision
   }
 
+  if (moving_end)
+    finish_moving_clauses ();
+
   if (stable) {
     STOP (stable);
     report (']');
@@ -81,6 +81,7 @@ extern "C" {
 #include "options.hpp"
 #include "parse.hpp"
 #include "phases.hpp"
+#include "pool.hpp"
 #include "profile.hpp"
 #include "proof.hpp"
 #include "queue.hpp"
@@ -103,6 +104,15 @@ extern "C" {
 
 /*------------------------------------------------------------------------*/
 
+// The watch replacement search in 'propagate' can use AVX2 gathers, which
+// read up to three bytes beyond the last value in 'vals' (thus padded).
+
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(COLOCATE)
+#define SIMD_PADDING 3
+#endif
+
+/*------------------------------------------------------------------------*/
+
 namespace CaDiCaL {
 
 using namespace std;
@@ -173,6 +183,8 @@ struct Internal {
   bool external_prop;         // true if an external propagator is connected
   bool did_external_prop;     // true if ext. propagation happened
   bool external_prop_is_lazy; // true if the external propagator is lazy
+  bool external_prop_view;    // external propagator uses 'notify_trail'
+  size_t external_prop_threshold; // assigned observed to wake propagator
   bool forced_backt_allowed;  // external propagator can force backtracking
   bool private_steps;    // no notification of ext. prop during these steps
   char rephased;         // last type of resetting phases
@@ -198,17 +210,27 @@ struct Internal {
   bool frat;                    // finalize non-deleted clauses in proof
   int level;                    // decision level ('control.size () - 1')
   Phases phases;                // saved, target and best phases
+#ifndef COLOCATE
   signed char *vals;            // assignment [-max_var,max_var]
+#endif
   vector<signed char> marks;    // signed marks [1,max_var]
   vector<unsigned> frozentab;   // frozen counters [1,max_var]
   vector<int> i2e;              // maps internal 'idx' to external 'lit'
   vector<unsigned> relevanttab; // Reference counts for observed variables.
+  vector<int> priorities;       // observed variables to decide first
+  vector<unsigned> priotab;     // position in 'priorities' plus one
+  size_t priority_unassigned;   // no unassigned 'priorities' before
   Queue queue;                  // variable move to front decision queue
   Links links;                  // table of links for decision queue
   double score_inc;             // current score increment
   ScoreSchedule scores;         // score based decision priority queue
   vector<double> stab;          // table of variable scores [1,max_var]
+#ifndef COLOCATE
   vector<Var> vtab;             // variable table [1,max_var]
+#else
+  vector<Assignment> atab;      // values and levels [1,max_var]
+  vector<Antecedent> rtab;      // trail heights and reasons [1,max_var]
+#endif
   vector<int> parents;          // parent literals during probing
   vector<Flags> ftab;           // variable and literal flags
   vector<int64_t> btab;         // enqueue time stamps for queue
@@ -218,6 +240,8 @@ struct Internal {
   vector<int64_t> ntab;         // number of one-sided occurrences table
   vector<Bins> big;             // binary implication graph
   vector<Watches> wtab;         // table of watches for all literals
+  vector<Watches> bintab;       // binary watches propagated first
+  bool bintab_valid;            // 'bintab' mirrors binary watches
   Clause *conflict;             // set in 'propagation', reset in 'analyze'
   Clause *ignore;               // ignored during 'vivify_propagate'
   Clause *dummy_binary;         // Dummy binary clause for subsumption
@@ -228,6 +252,15 @@ struct Internal {
   bool ext_clause_forgettable;  // Is new clause from propagator forgettable
   int tainted_literal;          // used for ILB
   size_t notified;           // next trail position to notify external prop
+  vector<int> etrail;        // notified observed external literals
+  vector<int> ext_batch;     // copy of externally propagated literals
+  int ext_batch_lit;         // single externally propagated literal
+  vector<size_t> elevels;    // end of each level in 'etrail'
+  vector<bool> etrailed;     // external variable on 'etrail'
+  ExternalTrail etrail_view; // view passed to 'notify_trail'
+  size_t etrail_notified;    // 'etrail' prefix passed to 'notify_trail'
+  int ext_cb_depth;          // nesting of external propagator callbacks
+  vector<Clause *> ext_reasons; // learned external reasons per literal
   Clause *probe_reason;      // set during probing
   size_t propagated;         // next trail position to propagate
   size_t propagated2;        // next binary trail position to propagate
@@ -255,6 +288,8 @@ struct Internal {
   vector<int> probes;       // remaining scheduled probes
   vector<Level> control;    // 'level + 1 == control.size ()'
   vector<Clause *> clauses; // ordered collection of all clauses
+  size_t moving_next;       // next clause to move incrementally
+  size_t moving_end;        // clauses to move incrementally
   Averages averages;        // glue, size, jump moving averages
   Limit lim;                // limits for various phases
   Last last;                // statistics at last occurrence
@@ -275,6 +310,9 @@ struct Internal {
   bool force_phase_messages; // force 'phase (...)' messages
 #endif
   Arena arena;          // memory arena for moving garbage collector
+#ifdef WATCHPOOL
+  WatchPool wpool; // memory of all watch lists
+#endif
   Format error_message; // provide persistent error message
   string prefix;        // verbose messages prefix
 
@@ -321,7 +359,9 @@ struct Internal {
 
   // Enlarge tables.
   //
+#ifndef COLOCATE
   void enlarge_vals (size_t new_vsize);
+#endif
   void enlarge (int new_max_var);
 
   // A variable is 'active' if it is not eliminated nor fixed.
@@ -392,7 +432,16 @@ struct Internal {
 
   // Helper functions to access variable and literal data.
   //
+#ifndef COLOCATE
   Var &var (int lit) { return vtab[vidx (lit)]; }
+#else
+  VarRef var (int lit) {
+    const int idx = vidx (lit);
+    Assignment &a = atab[idx];
+    Antecedent &r = rtab[idx];
+    return {a.level, r.trail, r.reason};
+  }
+#endif
   Link &link (int lit) { return links[vidx (lit)]; }
   Flags &flags (int lit) { return ftab[vidx (lit)]; }
   int64_t &bumped (int lit) { return btab[vidx (lit)]; }
@@ -401,6 +450,11 @@ struct Internal {
 
   const Flags &flags (int lit) const { return ftab[vidx (lit)]; }
 
+  // Observed variables are flagged (see 'add_observed_var'), thus testing
+  // the literals of the trail during notification is cheap.
+  //
+  bool observed (int ilit) const { return flags (ilit).observed; }
+
   bool occurring () const { return !otab.empty (); }
   bool watching () const { return !wtab.empty (); }
 
@@ -408,6 +462,12 @@ struct Internal {
   Occs &occs (int lit) { return otab[vlit (lit)]; }
   int64_t &noccs (int lit) { return ntab[vlit (lit)]; }
   Watches &watches (int lit) { return wtab[vlit (lit)]; }
+  Watches &binary_watches (int lit) { return bintab[vlit (lit)]; }
+#ifndef WATCHPOOL
+  Watches empty_watches () { return Watches (); }
+#else
+  Watches empty_watches () { return Watches (&wpool); }
+#endif
 
   // Variable bumping through exponential VSIDS (EVSIDS) as in MiniSAT.
   //
@@ -514,13 +574,38 @@ struct Internal {
   void unmark_clause (); // unmark 'this->clause'
   void unmark (Clause *);
 
+  // Map clauses to the references kept in watches and back, which only
+  // differ from clause pointers with '-DWATCH32' (see 'watch.hpp').
+  //
+  inline ClauseRef clause_ref (Clause *c) const {
+#ifndef WATCH32
+    return c;
+#else
+    return arena.ref (c);
+#endif
+  }
+
+  inline Clause *watched_clause (const Watch &w) const {
+#ifndef WATCH32
+    return w.clause;
+#else
+    return arena.clause (w.cref);
+#endif
+  }
+
   // Watch literal 'lit' in clause with blocking literal 'blit'.
   // Inlined here, since it occurs in the tight inner loop of 'propagate'.
   //
   inline void watch_literal (int lit, int blit, Clause *c) {
     assert (lit != blit);
     Watches &ws = watches (lit);
+#ifndef WATCH32
     ws.push_back (Watch (blit, c));
+#else
+    ws.push_back (Watch (blit, arena.ref (c), c->size));
+#endif
+    if (bintab_valid && c->size == 2)
+      binary_watches (lit).push_back (ws.back ());
     LOG (c, "watch %d blit %d in", lit, blit);
   }
 
@@ -537,8 +622,10 @@ struct Internal {
   inline void unwatch_clause (Clause *c) {
     const int l0 = c->literals[0];
     const int l1 = c->literals[1];
-    remove_watch (watches (l0), c);
-    remove_watch (watches (l1), c);
+    remove_watch (watches (l0), clause_ref (c));
+    remove_watch (watches (l1), clause_ref (c));
+    if (c->size == 2)
+      bintab_valid = false;
   }
 
   // Update queue to point to last potentially still unassigned variable.
@@ -671,6 +758,8 @@ struct Internal {
   Clause *learn_external_reason_clause (int lit, int falsified_elit = 0,
                                         bool no_backtrack = false);
   Clause *wrapped_learn_external_reason_clause (int lit);
+  Clause *cached_external_reason (int lit);
+  void flush_external_reasons ();
   void explain_external_propagations ();
   void explain_reason (int lit, Clause *, int &open);
   void move_literals_to_watch ();
@@ -678,12 +767,20 @@ struct Internal {
   void notify_assignments ();
   void notify_decision ();
   void notify_backtrack (size_t new_level);
+  void push_trail_view (int elit);
+  void update_trail_view ();
+  void notify_trail_view ();
+  void notify_fixed_observed (int elit);
+  bool external_prop_asleep () const;
+  uint64_t start_callback ();
+  void stop_callback (Stats::ExtCallback &, uint64_t started, size_t lits);
   void force_backtrack (size_t new_level);
   int ask_decision ();
   bool ask_external_clause ();
   void add_observed_var (int ilit);
   void remove_observed_var (int ilit);
-  bool observed (int ilit) const;
+  void prioritize_observed_var (int ilit);
+  void reset_priorities ();
   bool is_decision (int ilit);
   void check_watched_literal_invariants ();
   void set_tainted_literal ();
@@ -770,7 +867,7 @@ struct Internal {
   void remove_falsified_literals (Clause *);
   void mark_satisfied_clauses_as_garbage ();
   void copy_clause (Clause *);
-  void flush_watches (int lit, Watches &);
+  void flush_watches (int lit, vector<Watch> &);
   size_t flush_occs (int lit);
   void flush_all_occs_and_watches ();
   void update_reason_references ();
@@ -779,7 +876,16 @@ struct Internal {
   void check_clause_stats ();
   void check_var_stats ();
   bool arenaing ();
-  void garbage_collection ();
+  void garbage_collection (bool incremental = false);
+
+  // Incremental moving of clauses into the arena in 'collect.cpp'.
+  //
+  bool incremental_arena ();
+  void start_moving_clauses ();
+  void move_clause (size_t);
+  bool moving ();
+  void move_clauses ();
+  void finish_moving_clauses ();
 
   // only remove binary clauses from the watches
   void remove_garbage_binaries ();
@@ -800,6 +906,7 @@ struct Internal {
   void sort_watches ();
   void clear_watches ();
   void reset_watches ();
+  void connect_binary_watches ();
 
   // Regular forward subsumption checking in 'subsume.cpp'.
   //
@@ -1174,6 +1281,7 @@ struct Internal {
   int next_decision_variable_on_queue ();
   int next_decision_variable_with_best_score ();
   int next_decision_variable ();
+  int next_prioritized_variable ();
   int decide_phase (int idx, bool target);
   int likely_phase (int idx);
   bool better_decision (int lit, int other);
@@ -1265,7 +1373,12 @@ struct Internal {
     assert (-max_var <= lit);
     assert (lit);
     assert (lit <= max_var);
+#ifndef COLOCATE
     return vals[lit];
+#else
+    const signed char res = atab[abs (lit)].value;
+    return lit < 0 ? -res : res;
+#endif
   }
 
   // As suggested by Matt Ginsberg it might be useful to factor-out a common
@@ -1277,8 +1390,12 @@ struct Internal {
     assert (-max_var <= lit);
     assert (lit);
     assert (lit <= max_var);
+#ifndef COLOCATE
     vals[lit] = val;
     vals[-lit] = -val;
+#else
+    atab[abs (lit)].value = lit < 0 ? -val : val;
+#endif
   }
 
   // As 'val' but restricted to the root-level value of a literal.
@@ -1290,8 +1407,8 @@ struct Internal {
     assert (lit);
     assert (lit <= max_var);
     const int idx = vidx (lit);
-    int res = vals[idx];
-    if (res && vtab[idx].level)
+    int res = val (idx);
+    if (res && var (idx).level)
       res = 0;
     if (lit < 0)
       res = -res;
@@ -1403,6 +1520,13 @@ struct Internal {
 
   double time () { return opts.realtime ? real_time () : process_time (); }
 
+  // Advise transparent huge pages for large memory in 'resources.cpp'.
+  //
+  void huge_pages (void *start, size_t bytes);
+  template <class T> void huge_pages (vector<T> &v) {
+    huge_pages (v.data (), v.capacity () * sizeof (T));
+  }
+
   // Regularly reports what is going on in 'report.cpp'.
   //
   void report (char type, int verbose_level = 0);
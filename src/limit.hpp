@@ -56,7 +56,7 @@ struct Last {
   } probe;
   struct {
     int64_t conflicts;
-  } reduce, rephase;
+  } move, reduce, rephase;
   struct {
     int64_t marked;
   } ternary;
@@ -10,7 +10,7 @@ LratTracer::LratTracer (Internal *i, File *f, bool b)
     : internal (i), file (f), binary (b)
 #ifndef QUIET
       ,
-      added (0), deleted (0)
+      added (0), deleted (0), trusted (0)
 #endif
       ,
       latest_id (0) {
@@ -76,8 +76,7 @@ inline void LratTracer::put_binary_id (int64_t id) {
 
 /*------------------------------------------------------------------------*/
 
-void LratTracer::lrat_add_clause (uint64_t id, const vector<int> &clause,
-                                  const vector<uint64_t> &chain) {
+void LratTracer::lrat_flush_deletions () {
   if (delete_ids.size ()) {
     if (!binary)
       file->put (latest_id), file->put (" ");
@@ -97,6 +96,11 @@ void LratTracer::lrat_add_clause (uint64_t id, const vector<int> &clause,
       file->put ("0\n");
     delete_ids.clear ();
   }
+}
+
+void LratTracer::lrat_add_clause (uint64_t id, const vector<int> &clause,
+                                  const vector<uint64_t> &chain) {
+  lrat_flush_deletions ();
   latest_id = id;
 
   if (binary)
@@ -123,6 +127,31 @@ void LratTracer::lrat_add_clause (uint64_t id, const vector<int> &clause,
     file->put ("0\n"); // this is just 2c here
 }
 
+// Trusted clauses are written as 'ID t LITS 0' (and 't' ID LITS 0 in the
+// binary format) without antecedents, similar to the deletion steps.
+// Checkers supporting them (like a 't'-aware 'lrat-trim') add them without
+// checking, as 'drat-trim' does for 't' lines in DRAT.
+
+void LratTracer::lrat_add_trusted_clause (uint64_t id,
+                                          const vector<int> &clause) {
+  lrat_flush_deletions ();
+  latest_id = id;
+
+  if (binary)
+    file->put ('t'), put_binary_id (id);
+  else
+    file->put (id), file->put (" t ");
+  for (const auto &external_lit : clause)
+    if (binary)
+      put_binary_lit (external_lit);
+    else
+      file->put (external_lit), file->put (' ');
+  if (binary)
+    put_binary_zero ();
+  else
+    file->put ("0\n");
+}
+
 void LratTracer::lrat_delete_clause (uint64_t id) {
   delete_ids.push_back (id); // pushing off deletion for later
 }
@@ -141,6 +170,17 @@ void LratTracer::add_derived_clause (uint64_t id, bool,
 #endif
 }
 
+void LratTracer::add_trusted_original_clause (uint64_t id,
+                                              const vector<int> &clause) {
+  if (file->closed ())
+    return;
+  LOG ("LRAT TRACER tracing addition of trusted clause");
+  lrat_add_trusted_clause (id, clause);
+#ifndef QUIET
+  trusted++;
+#endif
+}
+
 void LratTracer::delete_clause (uint64_t id, bool, const vector<int> &) {
   if (file->closed ())
     return;
@@ -166,9 +206,11 @@ bool LratTracer::closed () { return file->closed (); }
 
 void LratTracer::print_statistics () {
   uint64_t bytes = file->bytes ();
-  uint64_t total = added + deleted;
+  uint64_t total = added + deleted + trusted;
   MSG ("LRAT %" PRId64 " added clauses %.2f%%", added,
        percent (added, total));
+  MSG ("LRAT %" PRId64 " trusted clauses %.2f%%", trusted,
+       percent (trusted, total));
   MSG ("LRAT %" PRId64 " deleted clauses %.2f%%", deleted,
        percent (deleted, total));
   MSG ("LRAT %" PRId64 " bytes (%.2f MB)", bytes,
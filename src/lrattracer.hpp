@@ -10,7 +10,7 @@ class LratTracer : public FileTracer {
   bool binary;
 
 #ifndef QUIET
-  int64_t added, deleted;
+  int64_t added, deleted, trusted;
 #endif
   uint64_t latest_id;
   vector<uint64_t> delete_ids;
@@ -20,8 +20,10 @@ class LratTracer : public FileTracer {
   void put_binary_id (int64_t id);
 
   // support LRAT
+  void lrat_flush_deletions ();
   void lrat_add_clause (uint64_t, const vector<int> &,
                         const vector<uint64_t> &);
+  void lrat_add_trusted_clause (uint64_t, const vector<int> &);
   void lrat_delete_clause (uint64_t);
 
 public:
@@ -38,6 +40,8 @@ public:
   void add_derived_clause (uint64_t, bool, const vector<int> &,
                            const vector<uint64_t> &) override;
 
+  void add_trusted_original_clause (uint64_t, const vector<int> &) override;
+
   void delete_clause (uint64_t, bool, const vector<int> &) override;
 
   void finalize_clause (uint64_t, const vector<int> &) override {} // skip
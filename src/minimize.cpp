@@ -18,7 +18,7 @@ bool Internal::minimize_literal (int lit, int depth) {
   LOG ("attempt to minimize lit %d at depth %d", lit, depth);
   assert (val (lit) > 0);
   Flags &f = flags (lit);
-  Var &v = var (lit);
+  VarRef v = var (lit);
   if (!v.level || f.removable || f.keep)
     return true;
   if (!v.reason || f.poison || v.level == level)
@@ -88,7 +88,7 @@ struct minimize_trail_level_positive_rank {
   typedef uint64_t Type;
   Type operator() (const int &a) const {
     assert (internal->val (a));
-    Var &v = internal->var (a);
+    VarRef v = internal->var (a);
     uint64_t res = v.level;
     res <<= 32;
     res |= v.trail;
@@ -159,13 +159,13 @@ void Internal::calculate_minimize_chain (int lit, std::vector<int> &stack) {
     assert (idx);
     stack.pop_back ();
     if (idx < 0) {
-      Var &v = var (idx);
+      VarRef v = var (idx);
       mini_chain.push_back (v.reason->id);
       continue;
     }
     assert (idx);
     Flags &f = flags (idx);
-    Var &v = var (idx);
+    VarRef v = var (idx);
     if (f.keep || f.added || f.poison) {
       continue;
     }
@@ -0,0 +1,45 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// See 'TrailMirror' in 'cadical.hpp'.
+
+void TrailMirror::assign (int lit) {
+  assert (lit);
+  assert (lit != INT_MIN);
+  const size_t idx = abs (lit);
+  if (idx >= values.size ())
+    values.resize (idx + 1, 0);
+  if (values[idx])
+    return;
+  values[idx] = lit < 0 ? -1 : 1;
+  lits.push_back (lit);
+}
+
+void TrailMirror::assign (const std::vector<int> &new_lits) {
+  for (const auto lit : new_lits)
+    assign (lit);
+}
+
+void TrailMirror::new_level () { ends.push_back (lits.size ()); }
+
+void TrailMirror::backtrack (size_t new_level) {
+  if (new_level >= ends.size ())
+    return;
+  const size_t end = ends[new_level];
+  for (size_t i = end; i < lits.size (); i++)
+    values[abs (lits[i])] = 0;
+  lits.resize (end);
+  ends.resize (new_level);
+}
+
+void TrailMirror::clear () {
+  for (const auto lit : lits)
+    values[abs (lit)] = 0;
+  lits.clear ();
+  ends.clear ();
+}
+
+} // namespace CaDiCaL
@@ -1255,9 +1255,11 @@ struct Call {
     FLUSHPROOFTRACE = shift ( 36 ),
     CLOSEPROOFTRACE = shift ( 37 ),
 
+    PRIORITIZE      = shift ( 38 ),
+
 #ifdef MOBICAL_MEMORY
-    MAXALLOC        = shift ( 38 ),
-    LEAKALLOC       = shift ( 39 ),
+    MAXALLOC        = shift ( 39 ),
+    LEAKALLOC       = shift ( 40 ),
 #endif
 
     // clang-format on
@@ -1271,7 +1273,8 @@ struct Call {
     ,
     CONFIG = INIT | SET | CONFIGURE | ALWAYS | TRACEPROOF,
     BEFORE =
-        ADD | CONSTRAIN | ASSUME | ALWAYS | DISCONNECT | CONNECT | OBSERVE,
+        ADD | CONSTRAIN | ASSUME | ALWAYS | DISCONNECT | CONNECT | OBSERVE |
+        PRIORITIZE,
     PROCESS = SOLVE | SIMPLIFY | LOOKAHEAD | CUBING | PROPAGATE,
     DURING = LEMMA, // | CONTINUE,
     AFTER = VAL | FLIP | FLIPPABLE | FAILED | CONCLUDE | ALWAYS |
@@ -1509,6 +1512,14 @@ struct ObserveCall : public Call {
   const char *keyword () { return "observe"; }
 };
 
+struct PrioritizeCall : public Call {
+  PrioritizeCall (int l) : Call (PRIORITIZE, l) {}
+  void execute (Solver *&s) { s->prioritize_observed_vars ({arg}); }
+  void print (ostream &o) { o << "prioritize " << arg << endl; }
+  Call *copy () { return new PrioritizeCall (arg); }
+  const char *keyword () { return "prioritize"; }
+};
+
 struct LemmaCall : public Call {
   LemmaCall (int l) : Call (LEMMA, l) {}
   void execute (Solver *&s) {
@@ -2510,6 +2521,12 @@ void Trace::generate_propagator (Random &random, int minvars, int maxvars) {
     push_back (new ObserveCall (lit));
     observed_vars.push_back (abs (lit));
   }
+  // Sometimes let the solver decide some of them first.
+  if (random.generate_double () < 0.2) {
+    for (auto idx : observed_vars)
+      if (random.generate_double () < 0.5)
+        push_back (new PrioritizeCall (idx));
+  }
   push_back (new ObserveCall (0));
   for (int idx = maxvars + 1; idx <= maxvars * 1.5; idx++) {
     if (random.generate_double () < 0.75)
@@ -3586,6 +3603,7 @@ static bool is_basic (Call *c) {
   case Call::LIMIT:
   case Call::OPTIMIZE:
   case Call::OBSERVE:
+  case Call::PRIORITIZE:
     return true;
   default:
     return false;
@@ -3843,6 +3861,7 @@ static bool has_lit_arg_type (Call *c) {
   case Call::RESERVE:
   case Call::LEMMA:
   case Call::OBSERVE:
+  case Call::PRIORITIZE:
     return true;
   default:
     return false;
@@ -4228,6 +4247,16 @@ void Reader::parse () {
       if (second)
         error ("additional argument '%s' to 'observe'", second);
       c = new ObserveCall (lit);
+    } else if (!strcmp (keyword, "prioritize")) {
+      if (!first)
+        error ("argument to 'prioritize' missing");
+      if (!parse_int_str (first, lit))
+        error ("invalid argument '%s' to 'prioritize'", first);
+      if (second)
+        error ("additional argument '%s' to 'prioritize'", second);
+      if (enforce && (!lit || lit == INT_MIN))
+        error ("invalid literal '%d' as argument to 'prioritize'", lit);
+      c = new PrioritizeCall (lit);
     } else if (!strcmp (keyword, "lemma")) {
       if (!first)
         error ("argument to 'lemma' missing");
@@ -4508,6 +4537,7 @@ void Reader::parse () {
       case Call::ADD:
       case Call::ASSUME:
       case Call::OBSERVE:
+      case Call::PRIORITIZE:
         if (state != Call::BEFORE)
           before_trigger = c;
         new_state = Call::BEFORE;
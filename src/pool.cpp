@@ -0,0 +1,150 @@
+#include "internal.hpp"
+
+#ifdef WATCHPOOL
+
+namespace CaDiCaL {
+
+WatchPool::WatchPool (Internal *i)
+    : internal (i), allocated (0), top (0), end (0) {}
+
+WatchPool::~WatchPool () { erase (); }
+
+void WatchPool::erase () {
+  for (auto &chunk : chunks)
+    delete[] chunk.start;
+  erase_vector (chunks);
+  for (auto &free_list : free_lists)
+    erase_vector (free_list);
+  allocated = 0;
+  top = end = 0;
+}
+
+// Splits the given range into power of two sized segments.
+
+void WatchPool::recycle (Watch *start, size_t watches) {
+  while (watches >= 2) {
+    const unsigned c = size_class (watches);
+    free_lists[c].push_back (start);
+    start += (size_t) 1 << c;
+    watches -= (size_t) 1 << c;
+  }
+}
+
+void WatchPool::add_chunk (size_t watches) {
+  recycle (top, end - top);
+  size_t size = max ((size_t) 1 << 12, allocated / 8);
+  size = max (size, watches);
+  top = new Watch[size];
+  end = top + size;
+  internal->huge_pages (top, size * sizeof (Watch));
+  chunks.push_back ({top, end});
+  allocated += size;
+  LOG ("added watch pool chunk of %zd watches", size);
+}
+
+Watch *WatchPool::allocate (unsigned c) {
+  assert (c < classes);
+  vector<Watch *> &free_list = free_lists[c];
+  if (!free_list.empty ()) {
+    Watch *res = free_list.back ();
+    free_list.pop_back ();
+    return res;
+  }
+  const size_t watches = (size_t) 1 << c;
+  if ((size_t) (end - top) < watches)
+    add_chunk (watches);
+  Watch *res = top;
+  top += watches;
+  return res;
+}
+
+void WatchPool::release (Watch *start, unsigned capacity) {
+  recycle (start, capacity);
+}
+
+// Slides all non-empty watch lists down in address order (of the chunks
+// and within chunks).  A watch list is never moved above its old position
+// within the same chunk and only to earlier chunks otherwise, where all
+// watch lists have already been moved.  The binary watch table is dropped
+// if it is invalid.
+
+struct watch_list_less {
+  bool operator() (const Watches *a, const Watches *b) const {
+    return std::less<const Watch *> () (a->begin (), b->begin ());
+  }
+};
+
+struct chunk_less {
+  template <class Chunk>
+  bool operator() (const Chunk &a, const Chunk &b) const {
+    return std::less<const Watch *> () (a.start, b.start);
+  }
+};
+
+void WatchPool::compact () {
+  vector<Watches *> lists;
+  size_t watches = 0;
+  for (int i = 0; i < 2; i++)
+    for (auto &ws : i ? internal->bintab : internal->wtab)
+      if (ws.empty () || (i && !internal->bintab_valid))
+        ws.start = 0, ws.count = ws.capacity = 0;
+      else
+        lists.push_back (&ws), watches += ws.count;
+  sort (lists.begin (), lists.end (), watch_list_less ());
+  sort (chunks.begin (), chunks.end (), chunk_less ());
+  for (auto &free_list : free_lists)
+    free_list.clear ();
+  const size_t old_allocated = allocated;
+  auto chunk = chunks.begin ();
+  top = chunks.empty () ? 0 : chunk->start;
+  end = chunks.empty () ? 0 : chunk->end;
+  for (auto ws : lists) {
+    while ((size_t) (end - top) < ws->count) {
+      recycle (top, end - top);
+      assert (chunk + 1 != chunks.end ());
+      top = (++chunk)->start;
+      end = chunk->end;
+    }
+    assert (!(chunk->start <= ws->start && ws->start < chunk->end) ||
+            top <= ws->start);
+    memmove (top, ws->start, ws->count * sizeof (Watch));
+    ws->start = top;
+    ws->capacity = ws->count;
+    top += ws->count;
+  }
+  if (!chunks.empty ()) {
+    for (auto other = chunk + 1; other != chunks.end (); other++) {
+      allocated -= other->end - other->start;
+      delete[] other->start;
+    }
+    chunks.resize (chunk - chunks.begin () + 1);
+  }
+  PHASE ("collect", internal->stats.collections,
+         "packed %zd watches in pool of %zd watches (previously %zd)",
+         watches, allocated, old_allocated);
+}
+
+/*------------------------------------------------------------------------*/
+
+void Watches::enlarge () {
+  assert (pool);
+  const unsigned c = capacity ? WatchPool::size_class (capacity) + 1 : 1;
+  Watch *new_start = pool->allocate (c);
+  if (count)
+    memcpy (new_start, start, count * sizeof (Watch));
+  if (capacity)
+    pool->release (start, capacity);
+  start = new_start;
+  capacity = 1u << c;
+}
+
+void Watches::release () {
+  if (capacity)
+    pool->release (start, capacity);
+  start = 0;
+  count = capacity = 0;
+}
+
+} // namespace CaDiCaL
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef _pool_hpp_INCLUDED
+#define _pool_hpp_INCLUDED
+
+#ifdef WATCHPOOL
+
+namespace CaDiCaL {
+
+// With '-DWATCHPOOL' the watch lists of all literals are kept in this pool
+// instead of allocating a vector for each literal separately, which avoids
+// millions of small heap allocations (each with its own overhead) for
+// large formulas and keeps watch lists of consecutive literals close in
+// memory.  The pool consists of large chunks from which segments with a
+// power of two many watches are cut off consecutively.  A watch list which
+// runs out of capacity moves to a twice as large segment and its old
+// segment is put on a free list (by size class) to be reused.
+
+// Chunks are never moved while watch lists are used, and thus iterators to
+// a watch list stay valid while watches are added to other lists (during
+// propagation for instance).  During garbage collection 'compact' slides
+// all watch lists in 'wtab' and 'bintab' down in address order, without
+// gaps and unused capacity, and then deletes the chunks no longer needed.
+// Sliding does not need additional memory as copying to a new chunk would.
+
+struct Watch;
+class Watches;
+struct Internal;
+
+class WatchPool {
+
+  Internal *internal;
+
+  struct Chunk {
+    Watch *start, *end;
+  };
+
+  vector<Chunk> chunks; // allocated chunks
+  size_t allocated;     // watches in all chunks
+  Watch *top, *end;     // unused part of the last chunk
+
+  static const unsigned classes = 32;
+  vector<Watch *> free_lists[classes]; // segments by size class
+
+  void add_chunk (size_t watches); // at least that many watches
+  void recycle (Watch *, size_t);  // put on free lists
+
+public:
+  // The size class of a segment with that many watches (rounded down).
+  //
+  static unsigned size_class (size_t watches) {
+    assert (watches);
+    unsigned res = 0;
+    while (watches >>= 1)
+      res++;
+    return res;
+  }
+
+  WatchPool (Internal *);
+  ~WatchPool ();
+
+  Watch *allocate (unsigned size_class);
+  void release (Watch *, unsigned capacity);
+
+  void compact (); // pack all watch lists
+  void erase ();   // after all watch lists are gone
+};
+
+} // namespace CaDiCaL
+
+#endif
+
+#endif
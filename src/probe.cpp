@@ -124,7 +124,7 @@ void Internal::probe_dominator_lrat (int dom, Clause *reason) {
       continue;
     f.seen = true;
     analyzed.push_back (other);
-    Var u = var (other);
+    VarRef u = var (other);
     if (u.level) {
       if (!u.reason) {
         LOG ("this may be a problem %d", other);
@@ -151,18 +151,17 @@ void Internal::probe_dominator_lrat (int dom, Clause *reason) {
 int Internal::probe_dominator (int a, int b) {
   require_mode (PROBE);
   int l = a, k = b;
-  Var *u = &var (l), *v = &var (k);
   assert (val (l) > 0), assert (val (k) > 0);
-  assert (u->level == 1), assert (v->level == 1);
+  assert (var (l).level == 1), assert (var (k).level == 1);
   while (l != k) {
-    if (u->trail > v->trail)
-      swap (l, k), swap (u, v);
+    if (var (l).trail > var (k).trail)
+      swap (l, k);
     if (!get_parent_reason_literal (l))
       return l;
     int parent = get_parent_reason_literal (k);
     assert (parent), assert (val (parent) > 0);
-    v = &var (k = parent);
-    assert (v->level == 1);
+    k = parent;
+    assert (var (k).level == 1);
   }
   LOG ("dominator %d of %d and %d", l, a, b);
   assert (val (l) > 0);
@@ -296,7 +295,7 @@ inline void Internal::probe_assign (int lit, int parent) {
   assert (!val (idx));
   assert (!flags (idx).eliminated () || !parent);
   assert (!parent || val (parent) > 0);
-  Var &v = var (idx);
+  VarRef v = var (idx);
   v.level = level;
   v.trail = (int) trail.size ();
   assert ((int) num_assigned < max_var);
@@ -394,11 +393,11 @@ inline void Internal::probe_propagate2 () {
       if (b > 0)
         continue;
       if (b < 0)
-        conflict = w.clause; // but continue
+        conflict = watched_clause (w); // but continue
       else {
         assert (lrat_chain.empty ());
         assert (!probe_reason);
-        probe_reason = w.clause;
+        probe_reason = watched_clause (w);
         probe_lrat_for_units (w.blit);
         probe_assign (w.blit, -lit);
         lrat_chain.clear ();
@@ -427,18 +426,19 @@ bool Internal::probe_propagate () {
         const signed char b = val (w.blit);
         if (b > 0)
           continue;
-        if (w.clause->garbage)
+        Clause *c = watched_clause (w);
+        if (c->garbage)
           continue;
-        const literal_iterator lits = w.clause->begin ();
+        const literal_iterator lits = c->begin ();
         const int other = lits[0] ^ lits[1] ^ lit;
         // lits[0] = other, lits[1] = lit;
         const signed char u = val (other);
         if (u > 0)
           ws[j - 1].blit = other;
         else {
-          const int size = w.clause->size;
+          const int size = c->size;
           const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const literal_iterator middle = lits + c->saved_pos ();
           literal_iterator k = middle;
           int r = 0;
           signed char v = -1;
@@ -446,39 +446,39 @@ bool Internal::probe_propagate () {
             k++;
           if (v < 0) {
             k = lits + 2;
-            assert (w.clause->pos <= size);
+            assert (c->saved_pos () <= size);
             while (k != middle && (v = val (r = *k)) < 0)
               k++;
           }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          c->save_pos (k - lits);
+          assert (lits + 2 <= k), assert (k <= c->end ());
           if (v > 0)
             ws[j - 1].blit = r;
           else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
+            LOG (c, "unwatch %d in", r);
             *k = lit;
             lits[0] = other;
             lits[1] = r;
-            watch_literal (r, lit, w.clause);
+            watch_literal (r, lit, c);
             j--;
           } else if (!u) {
             if (level == 1) {
               lits[0] = other, lits[1] = lit;
               assert (lrat_chain.empty ());
               assert (!probe_reason);
-              int dom = hyper_binary_resolve (w.clause);
+              int dom = hyper_binary_resolve (c);
               probe_assign (other, dom);
             } else {
               assert (lrat_chain.empty ());
               assert (!probe_reason);
-              probe_reason = w.clause;
+              probe_reason = c;
               probe_lrat_for_units (other);
               probe_assign_unit (other);
               lrat_chain.clear ();
             }
             probe_propagate2 ();
           } else
-            conflict = w.clause;
+            conflict = c;
         }
       }
       if (j != i) {
@@ -54,6 +54,7 @@ struct Internal;
   PROFILE (decompose, 3) \
   PROFILE (elim, 2) \
   PROFILE (extend, 3) \
+  PROFILE (external, 4) \
   PROFILE (instantiate, 2) \
   PROFILE (lucky, 2) \
   PROFILE (lookahead, 2) \
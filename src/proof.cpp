@@ -531,8 +531,14 @@ void Proof::add_original_clause (bool restore) {
 
   if (lratbuilder)
     lratbuilder->add_original_clause (clause_id, clause);
-  for (auto &tracer : tracers) {
-    tracer->add_original_clause (clause_id, false, clause, restore);
+  if (!restore && match_trusted ()) {
+    LOG (clause, "PROOF original clause is trusted");
+    for (auto &tracer : tracers)
+      tracer->add_trusted_original_clause (clause_id, clause);
+  } else {
+    for (auto &tracer : tracers) {
+      tracer->add_original_clause (clause_id, false, clause, restore);
+    }
   }
   clause.clear ();
   clause_id = 0;
@@ -553,11 +559,34 @@ void Proof::add_derived_clause () {
   clause_id = 0;
 }
 
-void Proof::add_trusted_clause (const vector<int> &clause) {
-  LOG (clause, "PROOF adding trusted clause");
+// Trusted clauses are announced right before they are added as original
+// clauses (through 'Solver::clause' or as external clauses of a
+// propagator).  Only the most recent announcement is kept pending until
+// the matching original clause arrives, which then is traced as trusted
+// with its clause ID.  An announced clause which never arrives (because it
+// was dropped while being imported for instance) is simply replaced by the
+// next announcement.
+
+void Proof::add_trusted_clause (const vector<int> &c) {
+  LOG (c, "PROOF adding trusted clause");
   for (auto &tracer : tracers) {
-    tracer->add_trusted_clause (clause);
+    tracer->add_trusted_clause (c);
   }
+  trusted = c;
+  sort (trusted.begin (), trusted.end ());
+  trusted.erase (unique (trusted.begin (), trusted.end ()), trusted.end ());
+}
+
+bool Proof::match_trusted () {
+  if (trusted.empty () || clause.size () < trusted.size ())
+    return false;
+  sorted = clause;
+  sort (sorted.begin (), sorted.end ());
+  sorted.erase (unique (sorted.begin (), sorted.end ()), sorted.end ());
+  if (sorted != trusted)
+    return false;
+  trusted.clear ();
+  return true;
 }
 
 void Proof::delete_clause () {
@@ -30,6 +30,10 @@ class Proof {
   vector<FileTracer *> file_tracers; // file tracers (ie LRAT tracer)
   LratBuilder *lratbuilder;          // special tracer
 
+  vector<int> trusted;   // last announced but not yet added (sorted)
+  vector<int> sorted;    // sorted copy of 'clause' for matching
+  bool match_trusted (); // 'clause' was announced trusted
+
   void add_literal (int internal_lit); // add to 'clause'
   void add_literals (Clause *);        // add to 'clause'
 
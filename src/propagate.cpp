@@ -110,7 +110,7 @@ inline void Internal::search_assign (int lit, Clause *reason) {
   assert (!val (idx));
   assert (!flags (idx).eliminated () || reason == decision_reason ||
           reason == external_reason);
-  Var &v = var (idx);
+  VarRef v = var (idx);
   int lit_level;
   assert (!lrat || level || reason == external_reason ||
           reason == decision_reason || !lrat_chain.empty ());
@@ -202,7 +202,6 @@ void Internal::search_assign_driving (int lit, Clause *c) {
 void Internal::search_assign_external (int lit) {
   require_mode (SEARCH);
   search_assign (lit, external_reason);
-  notify_assignments ();
 }
 
 /*------------------------------------------------------------------------*/
@@ -217,13 +216,58 @@ void Internal::search_assign_external (int lit) {
 // to reduce the number of times clauses have to be visited (2008 JSAT paper
 // by Chu, Harwood and Stuckey).  The watches know if a watched clause is
 // binary, in which case it never has to be visited.  If a binary clause is
-// falsified we continue propagating.
+// falsified we continue propagating.  If enabled with 'bintab' the binary
+// watches are also copied to 'bintab' (see 'watch.cpp') and are propagated
+// first in a separate tight loop, which then leaves only satisfied blocking
+// literals for binary clauses in the watch lists.  As the copies are still
+// visited (and skipped) in the watch lists this is disabled by default.
 
 // Finally, for long clauses we save the position of the last watch
 // replacement in 'pos', which in turn reduces certain quadratic accumulated
 // propagation costs (2013 JAIR article by Ian Gent) at the expense of four
 // more bytes for each clause.
 
+// For clauses with at least 'opts.simd' literals the search for a watch
+// replacement uses AVX2 instructions to gather the values of eight literals
+// at once, if supported by the CPU (checked at run-time) and compiler.
+// Each gather reads four bytes at 'vals + lit', for which 'vals' is padded
+// by 'SIMD_PADDING' bytes (see 'enlarge_vals').
+
+#ifdef SIMD_PADDING
+
+#include <immintrin.h>
+
+static bool avx2_supported () {
+  __builtin_cpu_init ();
+  return __builtin_cpu_supports ("avx2");
+}
+
+static const bool avx2 = avx2_supported ();
+
+// Find the first literal in '[k,end)' which is not assigned to false.
+
+__attribute__ ((target ("avx2"))) static const int *
+find_non_false_avx2 (const signed char *vals, const int *k,
+                     const int *end) {
+  const __m256i bytes = _mm256_set1_epi32 (0xff);
+  while (end - k >= 8) {
+    const __m256i lits = _mm256_loadu_si256 ((const __m256i *) k);
+    const __m256i gathered =
+        _mm256_i32gather_epi32 ((const int *) vals, lits, 1);
+    const __m256i values = _mm256_and_si256 (gathered, bytes);
+    const __m256i falsified = _mm256_cmpeq_epi32 (values, bytes);
+    const int mask = _mm256_movemask_ps (_mm256_castsi256_ps (falsified));
+    if (mask != 0xff)
+      return k + __builtin_ctz (~mask);
+    k += 8;
+  }
+  while (k != end && vals[*k] < 0)
+    k++;
+  return k;
+}
+
+#endif
+
 bool Internal::propagate () {
 
   if (level)
@@ -237,10 +281,51 @@ bool Internal::propagate () {
   //
   int64_t before = propagated;
 
+  const bool use_bintab = opts.bintab;
+  if (use_bintab && !bintab_valid)
+    connect_binary_watches ();
+
+  // Watches visited in the loop below with a falsified blocking literal
+  // require to access their clause, which is often a cache miss.  Thus we
+  // can prefetch the clause of the watch 'opts.prefetch' positions ahead
+  // as well as the watches of the next literal on the trail.  This did not
+  // give measurable improvements on large random instances though, which
+  // have short watch lists, and thus it is disabled by default.
+  //
+  const int prefetch = opts.prefetch;
+
+#ifdef SIMD_PADDING
+  const int simd = avx2 && opts.simd ? opts.simd : INT_MAX;
+#endif
+
   while (!conflict && propagated != trail.size ()) {
 
     const int lit = -trail[propagated++];
     LOG ("propagating %d", -lit);
+
+    if (prefetch && propagated != trail.size ()) {
+      const Watches &next = watches (-trail[propagated]);
+      if (!next.empty ())
+        __builtin_prefetch (next.data (), 0, 1);
+    }
+
+    if (use_bintab) {
+      for (const auto &w : binary_watches (lit)) {
+        const signed char b = val (w.blit);
+        if (b > 0)
+          continue;
+        Clause *c = watched_clause (w);
+        if (b < 0)
+          conflict = c; // but continue ...
+        else {
+          build_chain_for_units (w.blit, c, 0);
+          search_assign (w.blit, c);
+        }
+      }
+      if (conflict)
+        break;
+    }
+
     Watches &ws = watches (lit);
 
     const const_watch_iterator eow = ws.end ();
@@ -250,19 +335,28 @@ bool Internal::propagate () {
     while (i != eow) {
 
       const Watch w = *j++ = *i++;
+
+      if (prefetch && prefetch <= eow - i) {
+        const Watch &p = i[prefetch - 1];
+        if (!p.binary () && val (p.blit) <= 0)
+          __builtin_prefetch (watched_clause (p), 0, 1);
+      }
+
       const signed char b = val (w.blit);
 
       if (b > 0)
         continue; // blocking literal satisfied
 
+      Clause *c = watched_clause (w);
+
       if (w.binary ()) {
 
-        // assert (w.clause->redundant || !w.clause->garbage);
+        // assert (c->redundant || !c->garbage);
 
         // In principle we can ignore garbage binary clauses too, but that
         // would require to dereference the clause pointer all the time with
         //
-        // if (w.clause->garbage) { j--; continue; } // (*)
+        // if (c->garbage) { j--; continue; } // (*)
         //
         // This is too costly.  It is however necessary to produce correct
         // proof traces if binary clauses are traced to be deleted ('d ...'
@@ -285,15 +379,15 @@ bool Internal::propagate () {
         // there also only to simplify the code).
 
         if (b < 0)
-          conflict = w.clause; // but continue ...
+          conflict = c; // but continue ...
         else {
-          build_chain_for_units (w.blit, w.clause, 0);
-          search_assign (w.blit, w.clause);
+          build_chain_for_units (w.blit, c, 0);
+          search_assign (w.blit, c);
           // lrat_chain.clear (); done in search_assign
         }
 
       } else {
-        assert (w.clause->size > 2);
+        assert (c->size > 2);
 
         if (conflict)
           break; // Stop if there was a binary conflict already.
@@ -303,12 +397,12 @@ bool Internal::propagate () {
         // the solver.  Note, that this check is positive very rarely and
         // thus branch prediction should be almost perfect here.
 
-        if (w.clause->garbage) {
+        if (c->garbage) {
           j--;
           continue;
         }
 
-        literal_iterator lits = w.clause->begin ();
+        literal_iterator lits = c->begin ();
 
         // Simplify code by forcing 'lit' to be the second literal in the
         // clause.  This goes back to MiniSAT.  We use a branch-less version
@@ -334,8 +428,8 @@ bool Internal::propagate () {
           // one failed to find a replacement another one starting at the
           // first non-watched literal until the saved position.
 
-          const int size = w.clause->size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const int size = c->size;
+          const literal_iterator middle = lits + c->saved_pos ();
           const const_literal_iterator end = lits + size;
           literal_iterator k = middle;
 
@@ -344,20 +438,35 @@ bool Internal::propagate () {
           int r = 0;
           signed char v = -1;
 
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
+#ifdef SIMD_PADDING
+          if (size >= simd) {
+            k = (literal_iterator) find_non_false_avx2 (vals, k, end);
+            if (k == end) {
+              k = lits + 2;
+              assert (c->saved_pos () <= size);
+              k = (literal_iterator) find_non_false_avx2 (vals, k, middle);
+              if (k != middle)
+                v = val (r = *k);
+            } else
+              v = val (r = *k);
+          } else
+#endif
+          {
+            while (k != end && (v = val (r = *k)) < 0)
+              k++;
 
-          if (v < 0) { // need second search starting at the head?
+            if (v < 0) { // need second search starting at the head?
 
-            k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
+              k = lits + 2;
+              assert (c->saved_pos () <= size);
+              while (k != middle && (v = val (r = *k)) < 0)
+                k++;
+            }
           }
 
-          w.clause->pos = k - lits; // always save position
+          c->save_pos (k - lits); // always save position
 
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          assert (lits + 2 <= k), assert (k <= c->end ());
 
           if (v > 0) {
 
@@ -369,13 +478,13 @@ bool Internal::propagate () {
 
             // Found new unassigned replacement literal to be watched.
 
-            LOG (w.clause, "unwatch %d in", lit);
+            LOG (c, "unwatch %d in", lit);
 
             lits[0] = other;
             lits[1] = r;
             *k = lit;
 
-            watch_literal (r, lit, w.clause);
+            watch_literal (r, lit, c);
 
             j--; // Drop this watch from the watch list of 'lit'.
 
@@ -386,8 +495,8 @@ bool Internal::propagate () {
             // The other watch is unassigned ('!u') and all other literals
             // assigned to false (still 'v < 0'), thus we found a unit.
             //
-            build_chain_for_units (other, w.clause, 0);
-            search_assign (other, w.clause);
+            build_chain_for_units (other, c, 0);
+            search_assign (other, c);
             // lrat_chain.clear (); done in search_assign
 
             // Similar code is in the implementation of the SAT'18 paper on
@@ -417,11 +526,11 @@ bool Internal::propagate () {
                 assert (s);
                 assert (pos < size);
 
-                LOG (w.clause, "unwatch %d in", lit);
+                LOG (c, "unwatch %d in", lit);
                 lits[pos] = lit;
                 lits[0] = other;
                 lits[1] = s;
-                watch_literal (s, other, w.clause);
+                watch_literal (s, other, c);
 
                 j--; // Drop this watch from the watch list of 'lit'.
               }
@@ -434,7 +543,7 @@ bool Internal::propagate () {
             // The other watch is assigned false ('u < 0') and all other
             // literals as well (still 'v < 0'), thus we found a conflict.
 
-            conflict = w.clause;
+            conflict = c;
             break;
           }
         }
@@ -507,12 +616,13 @@ void Internal::propergate () {
         assert (val (w.blit) > 0);
         continue;
       }
-      if (w.clause->garbage) {
+      Clause *c = watched_clause (w);
+      if (c->garbage) {
         j--;
         continue;
       }
 
-      literal_iterator lits = w.clause->begin ();
+      literal_iterator lits = c->begin ();
 
       const int other = lits[0] ^ lits[1] ^ lit;
       const signed char u = val (other);
@@ -522,8 +632,8 @@ void Internal::propergate () {
         continue;
       assert (u < 0);
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
+      const int size = c->size;
+      const literal_iterator middle = lits + c->saved_pos ();
       const const_literal_iterator end = lits + size;
       literal_iterator k = middle;
 
@@ -535,23 +645,23 @@ void Internal::propergate () {
 
       if (v < 0) {
         k = lits + 2;
-        assert (w.clause->pos <= size);
+        assert (c->saved_pos () <= size);
         while (k != middle && (v = val (r = *k)) < 0)
           k++;
       }
 
-      assert (lits + 2 <= k), assert (k <= w.clause->end ());
-      w.clause->pos = k - lits;
+      assert (lits + 2 <= k), assert (k <= c->end ());
+      c->save_pos (k - lits);
 
       assert (v > 0);
 
-      LOG (w.clause, "unwatch %d in", lit);
+      LOG (c, "unwatch %d in", lit);
 
       lits[0] = other;
       lits[1] = r;
       *k = lit;
 
-      watch_literal (r, lit, w.clause);
+      watch_literal (r, lit, c);
 
       j--;
     }
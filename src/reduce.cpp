@@ -208,7 +208,7 @@ void Internal::reduce () {
     mark_clauses_to_be_flushed ();
   else
     mark_useless_redundant_clauses_as_garbage ();
-  garbage_collection ();
+  garbage_collection (true);
 
   {
     int64_t delta = opts.reduceint * (stats.reductions + 1);
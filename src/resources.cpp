@@ -32,6 +32,10 @@ extern "C" {
 #include <sys/types.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #endif
 
 #include <string.h>
@@ -157,4 +161,40 @@ uint64_t current_resident_set_size () {
 
 /*------------------------------------------------------------------------*/
 
+// Transparent huge pages are requested with 'madvise' on Linux only and
+// only for the page aligned part of the given memory.  It does not make
+// sense for less memory than one huge page (2 MB on x86-64).  If this
+// fails, for instance because huge pages are disabled in the kernel, the
+// memory just stays backed by normal pages.  Huge pages reserved for
+// 'MAP_HUGETLB' are usually not available and thus not used.
+
+bool advise_huge_pages (void *start, size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (bytes < ((size_t) 1 << 21))
+    return false;
+  const uintptr_t page = sysconf (_SC_PAGESIZE);
+  const uintptr_t begin = ((uintptr_t) start + page - 1) & ~(page - 1);
+  const uintptr_t end = ((uintptr_t) start + bytes) & ~(page - 1);
+  if (begin >= end)
+    return false;
+  return !madvise ((void *) begin, end - begin, MADV_HUGEPAGE);
+#else
+  (void) start, (void) bytes;
+  return false;
+#endif
+}
+
+// With 'opts.hugepages' the clause arena, the watch pool and the large
+// variable and literal indexed tables are advised to use huge pages,
+// since random accesses to them otherwise cause many TLB misses on very
+// large instances.  Memory should be advised before it is touched, since
+// otherwise it is only collapsed into huge pages later in the background.
+
+void Internal::huge_pages (void *start, size_t bytes) {
+  if (opts.hugepages && advise_huge_pages (start, bytes))
+    LOG ("advised %zd bytes at %p to use huge pages", bytes, start);
+}
+
+/*------------------------------------------------------------------------*/
+
 } // namespace CaDiCaL
@@ -3,6 +3,16 @@
 
 #include <cstdint>
 
+#if defined(__x86_64__) || defined(__i386__)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#include <chrono>
+#endif
+
 namespace CaDiCaL {
 
 double absolute_real_time ();
@@ -11,6 +21,19 @@ double absolute_process_time ();
 uint64_t maximum_resident_set_size ();
 uint64_t current_resident_set_size ();
 
+bool advise_huge_pages (void *start, size_t bytes);
+
+// Cheap time stamp for profiling very frequent events, which is the time
+// stamp counter on x86 and otherwise a monotonic clock in nanoseconds.
+
+inline uint64_t cycles () {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc ();
+#else
+  return std::chrono::steady_clock::now ().time_since_epoch ().count ();
+#endif
+}
+
 } // namespace CaDiCaL
 
 #endif // ifndef _resources_hpp_INCLUDED
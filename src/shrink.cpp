@@ -29,7 +29,7 @@ void Internal::mark_shrinkable_as_removable (
   for (; minimized_start < minimized.size (); ++minimized_start) {
     const int lit = minimized[minimized_start];
     Flags &f = flags (lit);
-    const Var &v = var (lit);
+    VarRef v = var (lit);
     if (v.level == blevel) {
       assert (!f.poison);
       ++minireset;
@@ -68,7 +68,7 @@ int inline Internal::shrink_literal (int lit, int blevel,
   assert (val (lit) < 0);
 
   Flags &f = flags (lit);
-  Var &v = var (lit);
+  VarRef v = var (lit);
   assert (v.level <= blevel);
 
   if (!v.level) {
@@ -128,7 +128,7 @@ unsigned Internal::shrunken_block_uip (
   assert (rend_block < clause.rend ());
   unsigned block_shrunken = 0;
   *rbegin_block = -uip;
-  Var &v = var (-uip);
+  VarRef v = var (-uip);
   Level &l = control[v.level];
   l.seen.trail = v.trail;
   l.seen.count = 1;
@@ -236,7 +236,7 @@ unsigned inline Internal::shrink_along_reason (int uip, int blevel,
 #ifndef NDEBUG
   const Flags &f = flags (uip);
 #endif
-  const Var &v = var (uip);
+  VarRef v = var (uip);
 
   assert (f.shrinkable);
   assert (v.level == blevel);
@@ -341,7 +341,7 @@ struct shrink_trail_negative_rank {
   shrink_trail_negative_rank (Internal *s) : internal (s) {}
   typedef uint64_t Type;
   Type operator() (int a) {
-    Var &v = internal->var (a);
+    VarRef v = internal->var (a);
     uint64_t res = v.level;
     res <<= 32;
     res |= v.trail;
@@ -378,8 +378,8 @@ std::vector<int>::reverse_iterator Internal::minimize_and_shrink_block (
     assert (rbegin_block <= clause.rend ());
     const int lit = *rbegin_block;
     const int idx = vidx (lit);
-    blevel = vtab[idx].level;
-    max_trail = vtab[idx].trail;
+    blevel = var (idx).level;
+    max_trail = var (idx).trail;
     LOG ("Block at level %i (first lit: %i)", blevel, lit);
 
     rend_block = rbegin_block;
@@ -388,13 +388,13 @@ std::vector<int>::reverse_iterator Internal::minimize_and_shrink_block (
       assert (rend_block < clause.rend () - 1);
       const int lit = *(++rend_block);
       const int idx = vidx (lit);
-      finished = (blevel != vtab[idx].level);
-      if (!finished && (unsigned) vtab[idx].trail > max_trail)
-        max_trail = vtab[idx].trail;
+      finished = (blevel != var (idx).level);
+      if (!finished && (unsigned) var (idx).trail > max_trail)
+        max_trail = var (idx).trail;
       ++open;
       LOG (
           "testing if lit %i is on the same level (of lit: %i, global: %i)",
-          lit, vtab[idx].level, blevel);
+          lit, var (idx).level, blevel);
 
     } while (!finished);
   }
@@ -998,6 +998,9 @@ void Solver::connect_external_propagator (ExternalPropagator *propagator) {
   internal->connect_propagator ();
   internal->external_prop = true;
   internal->external_prop_is_lazy = propagator->is_lazy;
+  internal->external_prop_view = propagator->uses_trail_view;
+  internal->external_prop_threshold =
+      propagator->uses_trail_view ? propagator->observed_threshold : 0;
   LOG_API_CALL_END ("connect_external_propagator");
 }
 
@@ -1018,6 +1021,8 @@ void Solver::disconnect_external_propagator () {
   internal->set_tainted_literal ();
   internal->external_prop = false;
   internal->external_prop_is_lazy = true;
+  internal->external_prop_view = false;
+  internal->external_prop_threshold = 0;
   LOG_API_CALL_END ("disconnect_external_propagator");
 }
 
@@ -1044,6 +1049,18 @@ void Solver::reset_observed_vars () {
   LOG_API_CALL_END ("reset_observed_vars");
 }
 
+// Traced per variable, such that mobical replays every single call.
+
+void Solver::prioritize_observed_vars (const std::vector<int> &vars) {
+  for (auto idx : vars) {
+    TRACE ("prioritize", idx);
+    REQUIRE_VALID_OR_SOLVING_STATE ();
+    REQUIRE_VALID_LIT (idx);
+    external->prioritize_observed_var (idx);
+    LOG_API_CALL_END ("prioritize", idx);
+  }
+}
+
 /*===== IPASIR-UP END ====================================================*/
 
 int Solver::active () const {
@@ -1743,8 +1760,12 @@ void Solver::error (const char *fmt, ...) {
   va_end (ap);
 }
 
+// Trusted clauses go to every proof tracer, which includes the internal
+// online checkers, even if no proof file was specified.
+
 void Solver::add_trusted_clause (const vector<int> &clause) {
-  if(proof_specified) internal->proof->add_trusted_clause (clause);
+  if (internal->proof)
+    internal->proof->add_trusted_clause (clause);
 }
 
 } // namespace CaDiCaL
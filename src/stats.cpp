@@ -169,9 +169,15 @@ void Stats::print (Internal *internal) {
     PRT ("  propagating:   %15" PRId64 "   %10.2f %%  per eprop-call",
          stats.ext_prop.eprop_prop,
          percent (stats.ext_prop.eprop_prop, stats.ext_prop.eprop_call));
+    PRT ("  batches:       %15" PRId64 "   %10.2f %%  per eprop-call",
+         stats.ext_prop.eprop_batch,
+         percent (stats.ext_prop.eprop_batch, stats.ext_prop.eprop_call));
     PRT ("  explained:     %15" PRId64 "   %10.2f %%  per eprop-call",
          stats.ext_prop.eprop_expl,
          percent (stats.ext_prop.eprop_expl, stats.ext_prop.eprop_call));
+    PRT ("  reused:        %15" PRId64 "   %10.2f %%  per explained",
+         stats.ext_prop.eprop_reused,
+         percent (stats.ext_prop.eprop_reused, stats.ext_prop.eprop_expl));
     PRT ("  falsified:     %15" PRId64 "   %10.2f %%  per eprop-call",
          stats.ext_prop.eprop_conf,
          percent (stats.ext_prop.eprop_conf, stats.ext_prop.eprop_call));
@@ -190,6 +196,44 @@ void Stats::print (Internal *internal) {
     PRT ("ext.final check: %15" PRId64 "   %10.2f %%  of queries",
          stats.ext_prop.echeck_call,
          percent (stats.ext_prop.echeck_call, stats.ext_prop.ext_cb));
+    PRT ("ext.prioritized: %15" PRId64 "   %10.2f %%  of decisions",
+         stats.ext_prop.eprio_dec,
+         percent (stats.ext_prop.eprio_dec, stats.decisions));
+    const Stats::ExtCallback *cbs[] = {
+        &stats.ext_cb.notify, &stats.ext_cb.propagate, &stats.ext_cb.clause,
+        &stats.ext_cb.decide, &stats.ext_cb.check};
+    const char *names[] = {"notify", "propagate", "clause", "decide",
+                           "check"};
+    int64_t calls = 0;
+    uint64_t cycles = 0;
+    for (const auto cb : cbs)
+      calls += cb->calls, cycles += cb->cycles;
+    PRT ("ext.callbacks:   %15" PRId64 "   %10.2f    cycles per call",
+         calls, relative (cycles, calls));
+    for (size_t i = 0; i < sizeof cbs / sizeof *cbs; i++) {
+      const Stats::ExtCallback &cb = *cbs[i];
+      if (!cb.calls)
+        continue;
+      PRT ("  %-15s%15" PRId64 "   %10.2f %%  cycles (%.0f per call)",
+           (string (names[i]) + ":").c_str (), cb.calls,
+           percent (cb.cycles, cycles), relative (cb.cycles, cb.calls));
+      PRT ("  %-15s%15" PRId64 "   %10.2f    per call",
+           (string (names[i]) + "lits:").c_str (), cb.lits,
+           relative (cb.lits, cb.calls));
+      // Histogram of cycles per call with bucket 'b' counting calls below
+      // '4^(b+1)' cycles, of which only non-empty buckets are shown.
+      string histogram;
+      for (int b = 0; b < Stats::ext_cb_buckets; b++) {
+        if (!cb.histogram[b])
+          continue;
+        char buffer[48];
+        snprintf (buffer, sizeof buffer, " <4^%d:%" PRId64, b + 1,
+                  cb.histogram[b]);
+        histogram += buffer;
+      }
+      PRT ("  %-15s%s", (string (names[i]) + "cycles:").c_str (),
+           histogram.c_str ());
+    }
   }
   if (all || stats.all.fixed) {
     PRT ("fixed:           %15" PRId64 "   %10.2f %%  of all variables",
@@ -577,6 +621,8 @@ void Checker::print_stats () {
        stats.propagations, relative (stats.propagations, stats.checks));
   MSG ("original:        %15" PRId64 "   %10.2f %%  of all clauses",
        stats.original, percent (stats.original, stats.added));
+  MSG ("trusted:         %15" PRId64 "   %10.2f %%  of original clauses",
+       stats.trusted, percent (stats.trusted, stats.original));
   MSG ("derived:         %15" PRId64 "   %10.2f %%  of all clauses",
        stats.derived, percent (stats.derived, stats.added));
   MSG ("deleted:         %15" PRId64 "   %10.2f %%  of all clauses",
@@ -11,6 +11,8 @@ struct Stats {
 
   Internal *internal;
 
+  static const int ext_cb_buckets = 16;
+
   int64_t vars; // internal initialized variables
   int num_sol; // number of solutions so far
 
@@ -28,12 +30,14 @@ struct Stats {
   } propagations;
 
   struct {
-    int64_t ext_cb;     // number of times any external callback was called
-    int64_t eprop_call; // number of times external_propagate was called
-    int64_t eprop_prop; // number of times external propagate propagated
+    int64_t ext_cb;      // number of times any external callback was called
+    int64_t eprop_call;  // number of times external_propagate was called
+    int64_t eprop_prop;  // number of times external propagate propagated
+    int64_t eprop_batch; // number of batches of external propagations
     int64_t
         eprop_conf; // number of times ex-propagate was already falsified
     int64_t eprop_expl; // number of times external propagate was explained
+    int64_t eprop_reused; // explained by reusing an earlier reason clause
     int64_t
         elearn_call;  // number of times external clause learning was tried
     int64_t elearned; // learned external clauses (incl. eprop explanations)
@@ -42,8 +46,28 @@ struct Stats {
     int64_t
         elearn_conf; // number of learned and conflicting external clauses
     int64_t echeck_call; // number of checking found complete solutions
+    int64_t eprio_dec;   // decisions on prioritized observed variables
   } ext_prop;
 
+  // Calls to the external propagator by kind of callback, with the cycles
+  // spent in them (as measured by 'cycles') and a histogram of calls with
+  // bucket 'i' counting calls taking less than '4^(i+1)' cycles.
+  //
+  struct ExtCallback {
+    int64_t calls;                 // number of callbacks
+    int64_t lits;                  // literals transferred
+    uint64_t cycles;               // cycles spent in callbacks
+    int64_t histogram[ext_cb_buckets]; // calls by log4 of cycles
+  };
+
+  struct {
+    ExtCallback notify;    // assignment, new level and backtrack
+    ExtCallback propagate; // propagated literals and batches
+    ExtCallback clause;    // external and reason clauses
+    ExtCallback decide;    // decisions
+    ExtCallback check;     // checking found complete solutions
+  } ext_cb;
+
   int64_t condassinit;  // initial assigned literals
   int64_t condassirem;  // initial assigned literals for blocked
   int64_t condassrem;   // remaining assigned literals for blocked
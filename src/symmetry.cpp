@@ -0,0 +1,335 @@
+#include "symmetry.hpp"
+#include <iostream>
+#include <numeric>
+
+StaticSymmetry::StaticSymmetry (CaDiCaL::Solver * s, int projected, long budget) : solver(s), budget(budget) {
+    max_var = s->vars();
+    n = projected ? projected : max_var;
+    assert (n <= max_var);
+    adj.resize(2 * max_var);
+    for (int idx = 1; idx <= max_var; idx++) {
+        const int pos = vertex(idx), neg = vertex(-idx);
+        adj[pos].push_back(neg);
+        adj[neg].push_back(pos);
+        const int c = idx <= n ? 0 : 2;
+        colour.push_back(c);
+        colour.push_back(c + 1);
+    }
+    // Root-level units are not necessarily traversed as clauses.
+    for (int idx = 1; idx <= max_var; idx++) {
+        const int tmp = s->fixed(idx);
+        if (tmp) add_clause_vertex({tmp > 0 ? idx : -idx});
+    }
+    struct Collector : CaDiCaL::ClauseIterator {
+        StaticSymmetry * symmetry;
+        bool clause (const std::vector<int> & c) {
+            symmetry->add_clause_vertex(c);
+            return true;
+        }
+    } collector;
+    collector.symmetry = this;
+    s->traverse_clauses(collector);
+}
+
+int StaticSymmetry::vertex (int lit) const {
+    return 2 * (abs(lit) - 1) + (lit < 0);
+}
+
+int StaticSymmetry::find (int v) {
+    while (orbit[v] != v) v = orbit[v] = orbit[orbit[v]];
+    return v;
+}
+
+// Duplicated literals are removed (the graph has to be simple for the
+// automorphism check) and tautological clauses are skipped.
+
+void StaticSymmetry::add_clause_vertex (const std::vector<int> & clause) {
+    std::vector<int> lits(clause);
+    std::sort(lits.begin(), lits.end());
+    lits.erase(std::unique(lits.begin(), lits.end()), lits.end());
+    for (int lit : lits) {
+        if (lit < 0 && std::binary_search(lits.begin(), lits.end(), -lit)) return;
+    }
+    const int c = adj.size();
+    adj.push_back(std::vector<int>());
+    colour.push_back(4);
+    for (int lit : lits) {
+        const int v = vertex(lit);
+        adj[c].push_back(v);
+        adj[v].push_back(c);
+    }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Split the cell '[start,stop)' according to the number of neighbours in
+// the current splitter cell.  The fragments are ordered by that number,
+// which keeps refinement invariant under relabeling of vertices.
+
+void StaticSymmetry::split (int start, int stop) {
+    std::sort(lab.begin() + start, lab.begin() + stop, [this] (int a, int b) { return count[a] < count[b]; });
+    if (count[lab[start]] == count[lab[stop - 1]]) return;
+    splits.push_back(std::make_pair(start, stop));
+    int first = start;
+    for (int i = start + 1; i <= stop; i++) {
+        if (i < stop && count[lab[i]] == count[lab[i - 1]]) continue;
+        end[first] = i;
+        for (int j = first; j < i; j++) cell[lab[j]] = first;
+        if (!queued[first]) {
+            queued[first] = 1;
+            queue.push_back(first);
+        }
+        first = i;
+    }
+}
+
+// Refine the partition until it is equitable with respect to the cells
+// on the queue.  Cells are processed in queue order and split in order of
+// their position.
+
+void StaticSymmetry::refine () {
+    refinements++;
+    for (size_t head = 0; head < queue.size(); head++) {
+        const int w = queue[head];
+        queued[w] = 0;
+        for (int i = w; i < end[w]; i++) {
+            for (int u : adj[lab[i]]) {
+                if (!count[u]++) touched.push_back(u);
+            }
+        }
+        for (int u : touched) {
+            const int c = cell[u];
+            if (marked[c]) continue;
+            marked[c] = 1;
+            cells.push_back(c);
+        }
+        std::sort(cells.begin(), cells.end());
+        for (int c : cells) {
+            marked[c] = 0;
+            if (end[c] - c > 1) split(c, end[c]);
+        }
+        for (int u : touched) count[u] = 0;
+        touched.clear();
+        cells.clear();
+    }
+    queue.clear();
+}
+
+void StaticSymmetry::individualize (int v) {
+    const int c = cell[v], e = end[c];
+    assert (e - c > 1);
+    int i = c;
+    while (lab[i] != v) i++;
+    std::swap(lab[i], lab[c]);
+    splits.push_back(std::make_pair(c, e));
+    end[c] = c + 1;
+    end[c + 1] = e;
+    for (int j = c + 1; j < e; j++) cell[lab[j]] = c + 1;
+    queued[c] = 1;
+    queue.push_back(c);
+}
+
+// Merge split cells again.  Vertices only move within their cell, thus
+// resetting cell starts and ends is enough.
+
+void StaticSymmetry::backtrack (size_t size) {
+    while (splits.size() > size) {
+        const int c = splits.back().first, e = splits.back().second;
+        splits.pop_back();
+        end[c] = e;
+        for (int j = c; j < e; j++) cell[lab[j]] = c;
+    }
+}
+
+int StaticSymmetry::target () const {
+    const int size = lab.size();
+    for (int i = 0; i < size; i = end[i]) {
+        if (end[i] - i > 1) return i;
+    }
+    return -1;
+}
+
+uint64_t StaticSymmetry::signature () const {
+    const int size = lab.size();
+    uint64_t res = 14695981039346656037ull;
+    for (int i = 0; i < size; i = end[i]) {
+        res ^= i;
+        res *= 1099511628211ull;
+    }
+    return res;
+}
+
+bool StaticSymmetry::exhausted () {
+    if (refinements < budget) return false;
+    incomplete = true;
+    return true;
+}
+
+// Check whether mapping the first leaf to the current discrete partition
+// is an automorphism and if so record it as generator.
+
+bool StaticSymmetry::automorphism () {
+    const int size = lab.size();
+    std::vector<int> gamma(size);
+    for (int i = 0; i < size; i++) gamma[leaf[i]] = lab[i];
+    for (int v = 0; v < size; v++) {
+        const int g = gamma[v];
+        if (adj[v].size() != adj[g].size()) return false;
+        current_stamp++;
+        for (int u : adj[g]) stamp[u] = current_stamp;
+        for (int u : adj[v]) {
+            if (stamp[gamma[u]] != current_stamp) return false;
+        }
+    }
+    for (int v = 0; v < size; v++) {
+        const int a = find(v), b = find(gamma[v]);
+        if (a != b) orbit[a] = b;
+    }
+    std::vector<int> sigma(max_var + 1);
+    bool moves = false;
+    for (int idx = 1; idx <= max_var; idx++) {
+        sigma[idx] = gamma[vertex(idx)] / 2 + 1;
+        if (idx <= n && sigma[idx] != idx) moves = true;
+    }
+    if (moves) generators.push_back(sigma);
+    return true;
+}
+
+// Search below the current node for a leaf equivalent to the first leaf,
+// following only nodes with the same partition signature as the first
+// path on the same depth.
+
+bool StaticSymmetry::search (size_t depth) {
+    const int t = target();
+    if (t < 0) return automorphism();
+    if (depth >= path.size()) return false;
+    const size_t size = splits.size();
+    const std::vector<int> candidates(lab.begin() + t, lab.begin() + end[t]);
+    for (int w : candidates) {
+        if (exhausted()) return false;
+        individualize(w);
+        refine();
+        const bool found = signature() == traces[depth + 1] && search(depth + 1);
+        backtrack(size);
+        if (found) return true;
+    }
+    return false;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Follow the first path down to a discrete partition and then, bottom-up,
+// try to map the individualized vertex of each level to the other members
+// of its cell which are not yet known to be in the same orbit.
+
+void StaticSymmetry::detect () {
+    const int size = adj.size();
+    lab.resize(size);
+    cell.resize(size);
+    end.resize(size);
+    count.assign(size, 0);
+    stamp.assign(size, 0);
+    queued.assign(size, 0);
+    marked.assign(size, 0);
+    orbit.resize(size);
+    std::iota(orbit.begin(), orbit.end(), 0);
+    std::iota(lab.begin(), lab.end(), 0);
+    std::stable_sort(lab.begin(), lab.end(), [this] (int a, int b) { return colour[a] < colour[b]; });
+    for (int i = 1, start = 0; i <= size; i++) {
+        if (i < size && colour[lab[i]] == colour[lab[i - 1]]) continue;
+        end[start] = i;
+        for (int j = start; j < i; j++) cell[lab[j]] = start;
+        queued[start] = 1;
+        queue.push_back(start);
+        start = i;
+    }
+    refine();
+    levels.push_back(splits.size());
+    traces.push_back(signature());
+    for (int t; (t = target()) >= 0;) {
+        const int v = lab[t];
+        path.push_back(v);
+        individualize(v);
+        refine();
+        levels.push_back(splits.size());
+        traces.push_back(signature());
+    }
+    leaf = lab;
+    for (size_t d = path.size(); d-- > 0 && !exhausted();) {
+        backtrack(levels[d]);
+        const int t = target();
+        const std::vector<int> candidates(lab.begin() + t, lab.begin() + end[t]);
+        for (int w : candidates) {
+            if (find(w) == find(path[d])) continue;
+            if (exhausted()) break;
+            individualize(w);
+            refine();
+            if (signature() == traces[d + 1]) search(d + 1);
+            backtrack(levels[d]);
+        }
+    }
+    backtrack(0);
+
+    std::vector<int> members(size, 0);
+    for (int idx = 1; idx <= n; idx++) members[find(vertex(idx))]++;
+    int orbits = 0, nontrivial = 0;
+    for (int idx = 1; idx <= n; idx++) {
+        const int m = members[find(vertex(idx))];
+        if (vertex(idx) == find(vertex(idx))) orbits++;
+        if (m > 1) nontrivial++;
+    }
+    std::cout << "c Symmetry: " << generators.size() << " generators after " << refinements << " refinements";
+    if (incomplete) std::cout << " (budget exhausted)";
+    std::cout << std::endl;
+    std::cout << "c Symmetry: " << n << " projected variables in " << orbits << " orbits (" << nontrivial << " in non-trivial orbits)" << std::endl;
+}
+
+/*------------------------------------------------------------------------*/
+
+void StaticSymmetry::add_clause (const std::vector<int> & clause) {
+    solver->add_trusted_clause(clause);
+    solver->clause(clause);
+}
+
+// Lex-leader constraints with auxiliary variables 'p_i' which are forced
+// to true if the prefix up to 'i' is equal.  The second pair of a 2-cycle
+// is always equal if the prefix including its first pair is, thus skipped.
+
+void StaticSymmetry::add_symmetry_breaking () {
+    int aux = solver->vars();
+    const int before = aux;
+    long clauses = 0;
+    std::vector<int> support, c;
+    for (const auto & sigma : generators) {
+        support.clear();
+        for (int i = 1; i <= n; i++) {
+            const int j = sigma[i];
+            if (j == i) continue;
+            if (j < i && sigma[j] == i) continue;
+            support.push_back(i);
+        }
+        int prev = 0;
+        for (size_t k = 0; k < support.size(); k++) {
+            const int i = support[k], j = sigma[i];
+            c.clear();
+            if (prev) c.push_back(-prev);
+            c.push_back(-i);
+            c.push_back(j);
+            add_clause(c), clauses++;
+            if (k + 1 == support.size()) break;
+            const int p = ++aux;
+            c.clear();
+            if (prev) c.push_back(-prev);
+            c.push_back(-i);
+            c.push_back(p);
+            add_clause(c), clauses++;
+            c.clear();
+            if (prev) c.push_back(-prev);
+            c.push_back(j);
+            c.push_back(p);
+            add_clause(c), clauses++;
+            prev = p;
+        }
+    }
+    std::cout << "c Symmetry: added " << clauses << " lex-leader clauses with " << aux - before << " auxiliary variables" << std::endl;
+}
@@ -0,0 +1,79 @@
+#ifndef _symmetry_hpp_INCLUDED
+#define _symmetry_hpp_INCLUDED
+
+#include "internal.hpp"
+
+// Static symmetry detection and lex-leader symmetry breaking for the
+// exhaustive search over the projection on the first 'n' variables.
+//
+// The clauses of the formula are turned into the usual clause-literal
+// graph: one vertex per literal, one vertex per clause connected to its
+// literals, and an edge between the two literals of each variable.
+// Literal vertices are coloured by sign and by whether the variable is
+// projected, thus only sign preserving variable permutations mapping the
+// projection onto itself are found.  Generators of the automorphism group
+// of this graph are computed with an individualization-refinement search
+// over equitable ordered partitions (in the style of 'nauty' and 'saucy'
+// but much simpler).  Partitions are only refined by splitting cells, and
+// these splits are trailed, which allows to backtrack without copying.
+// The search is bounded by 'budget' refinements, so the generators might
+// only generate a sub-group, which is still sound.
+//
+// For every generator 'sigma' the lex-leader constraint '(x_1 ... x_n) <=
+// (x_sigma(1) ... x_sigma(n))' restricted to the projected variables is
+// added using the compact encoding with one auxiliary variable per pair
+// (Aloul, Markov, Sakallah).  Each solution orbit of the projection keeps
+// at least its lexicographically smallest member, thus the exhaustive
+// search enumerates (a superset of) orbit representatives.
+
+class StaticSymmetry {
+
+    CaDiCaL::Solver * solver;
+    int n = 0;                      // number of projected variables
+    int max_var = 0;                // variables of the formula
+    long budget;                    // refinement limit
+    long refinements = 0;
+    bool incomplete = false;        // budget exhausted
+
+    std::vector<std::vector<int>> adj;          // clause-literal graph
+    std::vector<int> colour;                    // initial vertex colours
+    std::vector<std::vector<int>> generators;   // variable permutations
+    std::vector<int> orbit;                     // union-find over vertices
+
+    // The ordered partition and the trail of split cells.
+    //
+    std::vector<int> lab;           // vertex at position
+    std::vector<int> cell;          // start position of the cell of vertex
+    std::vector<int> end;           // end position of cell given its start
+    std::vector<std::pair<int, int>> splits;
+
+    std::vector<int> count, touched, cells, queue, stamp;
+    std::vector<char> queued, marked;
+    int current_stamp = 0;
+
+    std::vector<int> path;          // first path individualized vertices
+    std::vector<size_t> levels;     // first path trail sizes
+    std::vector<uint64_t> traces;   // first path partition signatures
+    std::vector<int> leaf;          // first path discrete partition
+
+    int vertex (int lit) const;
+    int find (int v);
+    void add_clause_vertex (const std::vector<int> & clause);
+    void split (int start, int stop);
+    void refine ();
+    void individualize (int v);
+    void backtrack (size_t size);
+    int target () const;
+    uint64_t signature () const;
+    bool automorphism ();
+    bool search (size_t depth);
+    bool exhausted ();
+    void add_clause (const std::vector<int> & clause);
+
+public:
+    StaticSymmetry (CaDiCaL::Solver * s, int projected, long budget = 1000000);
+    void detect ();
+    void add_symmetry_breaking ();
+};
+
+#endif
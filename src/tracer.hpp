@@ -45,6 +45,16 @@ public:
   // Notify the observer that a trusted clause has been derived.
   virtual void add_trusted_clause (const std::vector<int> &) {}
 
+  // Notify the tracer that an original clause has been added which was
+  // announced as trusted clause before.  Tracers with clause IDs use this
+  // to write a trusted step instead of skipping the original clause.
+  // Arguments: ID, clause
+  //
+  virtual void add_trusted_original_clause (uint64_t id,
+                                            const std::vector<int> &c) {
+    add_original_clause (id, false, c);
+  }
+
   // Notify the observer that a clause is deleted.
   // Includes ID and redundant/irredundant
   // Arguments: ID, redundant, clause
@@ -152,7 +152,7 @@ void Internal::transred () {
         const Watch &w = *k;
         if (!w.binary ())
           break; // since we sorted watches above
-        Clause *d = w.clause;
+        Clause *d = watched_clause (w);
         if (d == c)
           continue;
         if (irredundant && d->redundant)
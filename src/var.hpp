@@ -7,6 +7,8 @@ struct Clause;
 
 // This structure captures data associated with an assigned variable.
 
+#ifndef COLOCATE
+
 struct Var {
 
   // Note that none of these members is valid unless the variable is
@@ -17,6 +19,34 @@ struct Var {
   Clause *reason; // implication graph edge during search
 };
 
+typedef Var &VarRef;
+
+#else
+
+// If compiled with '-DCOLOCATE' (see './configure --colocate') the value
+// of a variable is stored next to its decision level in one 8 byte record
+// instead of in the separate literal indexed 'vals' table, and the trail
+// position and the reason are kept in another record.  Then 'var' returns
+// a 'VarRef' of references into both records instead of a 'Var'.
+
+struct Assignment {
+  signed char value; // value of the positive literal
+  int level;         // decision level
+};
+
+struct Antecedent {
+  int trail;      // trail height at assignment
+  Clause *reason; // implication graph edge during search
+};
+
+struct VarRef {
+  int &level;
+  int &trail;
+  Clause *&reason;
+};
+
+#endif
+
 } // namespace CaDiCaL
 
 #endif
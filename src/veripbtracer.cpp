@@ -238,6 +238,28 @@ void VeripbTracer::veripb_add_derived_clause (uint64_t id, bool redundant,
   }
 }
 
+// Trusted clauses use the unchecked assumption rule 'a', which keeps the
+// implicit constraint IDs of VeriPB in sync with our clause IDs.
+
+void VeripbTracer::veripb_add_trusted_clause (uint64_t id,
+                                              const vector<int> &clause) {
+  file->put ("a ");
+  for (const auto &external_lit : clause) {
+    file->put ("1 ");
+    if (external_lit < 0)
+      file->put ('~');
+    file->put ('x');
+    file->put (abs (external_lit));
+    file->put (' ');
+  }
+  file->put (">= 1 ;\n");
+  if (checked_deletions) {
+    file->put ("core id ");
+    file->put (id);
+    file->put ("\n");
+  }
+}
+
 void VeripbTracer::veripb_begin_proof (uint64_t reserved_ids) {
   file->put ("pseudo-Boolean proof version 2.0\n");
   file->put ("f ");
@@ -302,6 +324,17 @@ void VeripbTracer::add_derived_clause (uint64_t id, bool redundant,
 #endif
 }
 
+void VeripbTracer::add_trusted_original_clause (uint64_t id,
+                                                const vector<int> &clause) {
+  if (file->closed ())
+    return;
+  LOG ("VERIPB TRACER tracing addition of trusted clause[%" PRId64 "]", id);
+  veripb_add_trusted_clause (id, clause);
+#ifndef QUIET
+  added++;
+#endif
+}
+
 void VeripbTracer::delete_clause (uint64_t id, bool redundant,
                                   const vector<int> &) {
   if (file->closed ())
@@ -62,6 +62,7 @@ class VeripbTracer : public FileTracer {
                                   const vector<uint64_t> &chain);
   void veripb_add_derived_clause (uint64_t, bool redundant,
                                   const vector<int> &clause);
+  void veripb_add_trusted_clause (uint64_t, const vector<int> &clause);
   void veripb_begin_proof (uint64_t reserved_ids);
   void veripb_delete_clause (uint64_t id, bool redundant);
   void veripb_report_status (bool unsat, uint64_t conflict_id);
@@ -81,6 +82,8 @@ public:
   void add_derived_clause (uint64_t, bool, const vector<int> &,
                            const vector<uint64_t> &) override;
 
+  void add_trusted_original_clause (uint64_t, const vector<int> &) override;
+
   void delete_clause (uint64_t, bool, const vector<int> &) override;
   void finalize_clause (uint64_t, const vector<int> &) override {} // skip
 
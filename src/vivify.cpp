@@ -51,9 +51,9 @@ namespace CaDiCaL {
 inline void Internal::vivify_assign (int lit, Clause *reason) {
   require_mode (VIVIFY);
   const int idx = vidx (lit);
-  assert (!vals[idx]);
+  assert (!val (idx));
   assert (!flags (idx).eliminated () || !reason);
-  Var &v = var (idx);
+  VarRef v = var (idx);
   v.level = level;               // required to reuse decisions
   v.trail = (int) trail.size (); // used in 'vivify_better_watch'
   assert ((int) num_assigned < max_var);
@@ -99,11 +99,12 @@ bool Internal::vivify_propagate () {
         const signed char b = val (w.blit);
         if (b > 0)
           continue;
+        Clause *c = watched_clause (w);
         if (b < 0)
-          conflict = w.clause; // but continue
+          conflict = c; // but continue
         else {
-          build_chain_for_units (w.blit, w.clause, 0);
-          vivify_assign (w.blit, w.clause);
+          build_chain_for_units (w.blit, c, 0);
+          vivify_assign (w.blit, c);
           lrat_chain.clear ();
         }
       }
@@ -120,21 +121,22 @@ bool Internal::vivify_propagate () {
           continue;
         if (val (w.blit) > 0)
           continue;
-        if (w.clause->garbage) {
+        Clause *c = watched_clause (w);
+        if (c->garbage) {
           j--;
           continue;
         }
-        if (w.clause == ignore)
+        if (c == ignore)
           continue;
-        literal_iterator lits = w.clause->begin ();
+        literal_iterator lits = c->begin ();
         const int other = lits[0] ^ lits[1] ^ lit;
         const signed char u = val (other);
         if (u > 0)
           j[-1].blit = other;
         else {
-          const int size = w.clause->size;
+          const int size = c->size;
           const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const literal_iterator middle = lits + c->saved_pos ();
           literal_iterator k = middle;
           signed char v = -1;
           int r = 0;
@@ -142,30 +144,30 @@ bool Internal::vivify_propagate () {
             k++;
           if (v < 0) {
             k = lits + 2;
-            assert (w.clause->pos <= size);
+            assert (c->saved_pos () <= size);
             while (k != middle && (v = val (r = *k)) < 0)
               k++;
           }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          c->save_pos (k - lits);
+          assert (lits + 2 <= k), assert (k <= c->end ());
           if (v > 0)
             j[-1].blit = r;
           else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
+            LOG (c, "unwatch %d in", r);
             lits[0] = other;
             lits[1] = r;
             *k = lit;
-            watch_literal (r, lit, w.clause);
+            watch_literal (r, lit, c);
             j--;
           } else if (!u) {
             assert (v < 0);
-            vivify_chain_for_units (other, w.clause);
-            vivify_assign (other, w.clause);
+            vivify_chain_for_units (other, c);
+            vivify_assign (other, c);
             lrat_chain.clear ();
           } else {
             assert (u < 0);
             assert (v < 0);
-            conflict = w.clause;
+            conflict = c;
             break;
           }
         }
@@ -430,7 +432,7 @@ void Internal::vivify_analyze_redundant (Vivifier &vivifier, Clause *start,
     stack.pop_back ();
     LOG (c, "vivify analyze");
     for (const auto &lit : *c) {
-      Var &v = var (lit);
+      VarRef v = var (lit);
       if (!v.level)
         continue;
       Flags &f = flags (lit);
@@ -461,7 +463,7 @@ bool Internal::vivify_all_decisions (Clause *c, int subsume) {
       continue;
     if (val (other) >= 0)
       return false;
-    Var &v = var (other);
+    VarRef v = var (other);
     if (!v.level)
       continue;
     if (v.reason)
@@ -503,7 +505,7 @@ void Internal::vivify_post_process_analysis (Clause *c, int subsume) {
       else if (val (other) >= 0)
         action = FLUSH;
       else {
-        Var &v = var (other);
+        VarRef v = var (other);
         if (!v.level)
           action = IGNORE;
         else if (v.reason)
@@ -787,7 +789,7 @@ void Internal::vivify_clause (Vivifier &vivifier, Clause *c) {
 
     if (tmp) { // literal already assigned
 
-      const Var &v = var (lit);
+      VarRef v = var (lit);
 
       if (!v.level) {
         LOG ("skipping fixed %d", lit);
@@ -986,7 +988,7 @@ void Internal::vivify_clause (Vivifier &vivifier, Clause *c) {
     //
     for (const auto &other : *c) {
       assert (val (other) || other == remove);
-      Var &v = var (other);
+      VarRef v = var (other);
       if (!v.level) { // Remove root-level fixed literals.
         continue;
       }
@@ -1067,7 +1069,7 @@ void Internal::vivify_build_lrat (
     for (const auto &other : *reason) {
       if (other == lit)
         continue;
-      Var &v = var (other);
+      VarRef v = var (other);
       Flags &f = flags (other);
       if (f.seen)
         continue; // we would lik // assert (val (other) < 0);e to assert
@@ -126,7 +126,7 @@ unsigned Internal::walk_break_value (int lit) {
       continue;
     }
 
-    Clause *c = w.clause;
+    Clause *c = watched_clause (w);
     assert (lit == c->literals[0]);
 
     // Now try to find a second satisfied literal starting at 'literals[1]'
@@ -345,7 +345,7 @@ void Internal::walk_flip_lit (Walker &walker, int lit) {
     LOG ("trying to brake %zd watched clauses", ws.size ());
 
     for (const auto &w : ws) {
-      Clause *d = w.clause;
+      Clause *d = watched_clause (w);
       LOG (d, "unwatch %d in", -lit);
       int *literals = d->literals, replacement = 0, prev = -lit;
       assert (literals[0] == -lit);
@@ -396,7 +396,7 @@ inline void Internal::walk_save_minimum (Walker &walker) {
   VERBOSE (3, "new global minimum %" PRId64 "", broken);
   stats.walk.minimum = broken;
   for (auto i : vars) {
-    const signed char tmp = vals[i];
+    const signed char tmp = val (i);
     if (tmp)
       phases.min[i] = phases.saved[i] = tmp;
   }
@@ -499,7 +499,7 @@ int Internal::walk_round (int64_t limit, bool prev) {
         LOG ("skipping inactive variable %d", idx);
         continue;
       }
-      if (vals[idx]) {
+      if (val (idx)) {
         assert (var (idx).level == 1);
         LOG ("skipping assumed variable %d", idx);
         continue;
@@ -5,21 +5,50 @@ namespace CaDiCaL {
 void Internal::init_watches () {
   assert (wtab.empty ());
   if (wtab.size () < 2 * vsize)
-    wtab.resize (2 * vsize, Watches ());
+    wtab.resize (2 * vsize, empty_watches ());
+  bintab_valid = false;
   LOG ("initialized watcher tables");
 }
 
 void Internal::clear_watches () {
   for (auto lit : lits)
     watches (lit).clear ();
+  bintab_valid = false;
 }
 
 void Internal::reset_watches () {
   assert (!wtab.empty ());
   erase_vector (wtab);
+  erase_vector (bintab);
+  bintab_valid = false;
+#ifdef WATCHPOOL
+  wpool.erase ();
+#endif
   LOG ("reset watcher tables");
 }
 
+// With 'opts.bintab' the binary watches of each literal are copied to
+// 'bintab', which allows 'propagate' to go over them in a tight loop before
+// visiting the watches of the literal.  The copies are kept up-to-date
+// while clauses are watched and during garbage collection.  All other
+// changes removing binary watches just invalidate the table, which is then
+// rebuilt here from scratch before the next propagation.
+
+void Internal::connect_binary_watches () {
+  assert (!bintab_valid);
+  if (bintab.size () < 2 * vsize)
+    bintab.resize (2 * vsize, empty_watches ());
+  for (auto lit : lits) {
+    Watches &bs = binary_watches (lit);
+    bs.clear ();
+    for (const auto &w : watches (lit))
+      if (w.binary ())
+        bs.push_back (w);
+  }
+  bintab_valid = true;
+  LOG ("connected binary watches");
+}
+
 // This can be quite costly since lots of memory is accessed in a rather
 // random fashion, and thus we optionally profile it.
 
@@ -79,7 +108,7 @@ void Internal::connect_watches (bool irredundant_only) {
 void Internal::sort_watches () {
   assert (watching ());
   LOG ("sorting watches");
-  Watches saved;
+  vector<Watch> saved;
   for (auto lit : lits) {
     Watches &ws = watches (lit);
 
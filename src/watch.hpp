@@ -26,29 +26,142 @@ namespace CaDiCaL {
 
 struct Clause;
 
+// If compiled with '-DWATCH32' (see './configure --watch32') all clauses
+// are allocated in the arena (see 'arena.hpp') and watches refer to them
+// by their 8 byte aligned offset in the arena, which takes 31 bits.  The
+// remaining bit denotes binary clauses and thus watches only need 8 bytes
+// instead of 16 (but then clauses can only take '16 GB' in total).  The
+// referenced clause is obtained with 'Internal::watched_clause'.
+
+#ifndef WATCH32
+typedef Clause *ClauseRef;
+#else
+typedef unsigned ClauseRef;
+#endif
+
 struct Watch {
 
+#ifndef WATCH32
+
   Clause *clause;
   int blit;
   int size;
 
   Watch (int b, Clause *c) : clause (c), blit (b), size (c->size) {}
-  Watch () {}
 
   bool binary () const { return size == 2; }
+  ClauseRef ref () const { return clause; }
+  void resize (int new_size) { size = new_size; }
+
+#else
+
+  int blit;
+  unsigned bin : 1;
+  unsigned cref : 31;
+
+  Watch (int b, ClauseRef r, int size)
+      : blit (b), bin (size == 2), cref (r) {}
+
+  bool binary () const { return bin; }
+  ClauseRef ref () const { return cref; }
+  void resize (int new_size) { bin = (new_size == 2); }
+
+#endif
+
+  Watch () {}
 };
 
+#ifndef WATCHPOOL
+
 typedef vector<Watch> Watches; // of one literal
 
+#else
+
+// If compiled with '-DWATCHPOOL' (see './configure --watchpool') the watch
+// list of a literal is not a 'vector' with its own heap allocation but a
+// segment of one of the large chunks of the 'WatchPool' (see 'pool.hpp').
+// Segments grow by moving to a larger segment and are packed again during
+// garbage collection.  Thus the interface below only provides the part of
+// the 'vector' interface actually used for watch lists.
+
+class WatchPool;
+
+class Watches {
+
+  friend class WatchPool;
+
+  Watch *start;
+  unsigned count, capacity;
+  WatchPool *pool;
+
+  void enlarge (); // move to segment of twice the capacity
+
+public:
+  typedef Watch *iterator;
+  typedef const Watch *const_iterator;
+
+  Watches (WatchPool *p = 0)
+      : start (0), count (0), capacity (0), pool (p) {}
+
+  iterator begin () { return start; }
+  iterator end () { return start + count; }
+  const_iterator begin () const { return start; }
+  const_iterator end () const { return start + count; }
+
+  Watch *data () { return start; }
+  const Watch *data () const { return start; }
+
+  size_t size () const { return count; }
+  bool empty () const { return !count; }
+
+  Watch &operator[] (size_t i) {
+    assert (i < count);
+    return start[i];
+  }
+  const Watch &operator[] (size_t i) const {
+    assert (i < count);
+    return start[i];
+  }
+  Watch &back () {
+    assert (count);
+    return start[count - 1];
+  }
+
+  void push_back (const Watch &w) {
+    if (count == capacity)
+      enlarge ();
+    start[count++] = w;
+  }
+
+  void resize (size_t new_size) {
+    assert (new_size <= count);
+    count = new_size;
+  }
+  void clear () { count = 0; }
+
+  void release (); // give segment back to the pool
+};
+
+// Unused capacity is only reclaimed by packing the pool.
+
+inline void shrink_vector (Watches &ws) {
+  if (ws.empty ())
+    ws.release ();
+}
+
+inline void erase_vector (Watches &ws) { ws.release (); }
+
+#endif
+
 typedef Watches::iterator watch_iterator;
 typedef Watches::const_iterator const_watch_iterator;
 
-inline void remove_watch (Watches &ws, Clause *clause) {
+inline void remove_watch (Watches &ws, ClauseRef ref) {
   const auto end = ws.end ();
   auto i = ws.begin ();
   for (auto j = i; j != end; j++) {
     const Watch &w = *i++ = *j;
-    if (w.clause == clause)
+    if (w.ref () == ref)
       i--;
   }
   assert (i + 1 == end);
@@ -56,13 +169,15 @@ inline void remove_watch (Watches &ws, Clause *clause) {
 }
 
 // search for the clause and updates the size marked in the watch lists
-inline void update_watch_size (Watches &ws, int blit, Clause *conflict) {
+inline void update_watch_size (Watches &ws, int blit, ClauseRef ref,
+                               int size) {
   bool found = false;
-  const int size = conflict->size;
   for (Watch &w : ws) {
-    if (w.clause == conflict)
-      w.size = size, w.blit = blit, found = true;
+    if (w.ref () == ref)
+      w.resize (size), w.blit = blit, found = true;
+#ifndef WATCH32
     assert (w.clause->garbage || w.size == 2 || w.clause->size != 2);
+#endif
   }
   assert (found), (void) found;
 }
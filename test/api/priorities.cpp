@@ -0,0 +1,113 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <vector>
+using namespace std;
+
+// Solves an unsatisfiable pigeon hole formula with all variables observed,
+// where the first third of the variables is prioritized (in reverse order)
+// right away and the second third on the first backtrack during solving.
+// The decision of every new level, which is the first notified literal of
+// that level, has to be the first unassigned prioritized variable, also
+// after backtracking, and the propagator should only be asked for a
+// decision if all prioritized variables are assigned.
+
+const int holes = 6, pigeons = holes + 1, n = holes * pigeons;
+
+static int var (int p, int h) { return p * holes + h + 1; }
+
+class Prioritized : public CaDiCaL::ExternalPropagator {
+  CaDiCaL::Solver *solver;
+  CaDiCaL::TrailMirror mirror;
+  vector<int> priorities;
+  bool new_level = false;
+
+  int first_unassigned () const {
+    for (auto idx : priorities)
+      if (!mirror.value (idx))
+        return idx;
+    return 0;
+  }
+
+  void prioritize (int from, int to) {
+    vector<int> vars;
+    for (int idx = to; idx >= from; idx--)
+      vars.push_back (idx);
+    solver->prioritize_observed_vars (vars);
+    priorities.insert (priorities.end (), vars.begin (), vars.end ());
+  }
+
+public:
+  int decisions = 0, late = 0, asked = 0, backtracks = 0;
+
+  Prioritized (CaDiCaL::Solver *s) : solver (s) {
+    solver->connect_external_propagator (this);
+    for (int idx = 1; idx <= n; idx++)
+      solver->add_observed_var (idx);
+    prioritize (1, n / 3);
+  }
+  ~Prioritized () { solver->disconnect_external_propagator (); }
+
+  void notify_assignment (const vector<int> &lits) override {
+    for (auto lit : lits) {
+      if (new_level) {
+        const int idx = first_unassigned ();
+        assert (!idx || idx == abs (lit));
+        decisions += !!idx;
+        late += (idx > n / 3);
+        new_level = false;
+      }
+      mirror.assign (lit);
+    }
+  }
+  void notify_new_decision_level () override {
+    assert (!new_level);
+    mirror.new_level ();
+    new_level = true;
+  }
+
+  // A conflict during propagation of a decision leads to backtracking
+  // before the decision was notified.
+
+  void notify_backtrack (size_t new_level) override {
+    this->new_level = false;
+    if (!backtracks++)
+      prioritize (n / 3 + 1, 2 * n / 3);
+    mirror.backtrack (new_level);
+  }
+  int cb_decide () override {
+    assert (!first_unassigned ());
+    asked++;
+    return 0;
+  }
+  bool cb_check_found_model (const vector<int> &) override { return true; }
+  bool cb_has_external_clause (bool &) override { return false; }
+  int cb_add_external_clause_lit () override { return 0; }
+};
+
+int main () {
+  CaDiCaL::Solver solver;
+  for (int p = 0; p < pigeons; p++) {
+    for (int h = 0; h < holes; h++)
+      solver.add (var (p, h));
+    solver.add (0);
+  }
+  for (int h = 0; h < holes; h++)
+    for (int p = 0; p < pigeons; p++)
+      for (int q = p + 1; q < pigeons; q++)
+        solver.clause (-var (p, h), -var (q, h));
+  Prioritized propagator (&solver);
+  int res = solver.solve ();
+  assert (res == 20);
+  cout << propagator.decisions << " prioritized decisions ("
+       << propagator.late << " prioritized late) with "
+       << propagator.backtracks << " backtracks and " << propagator.asked
+       << " asked decisions" << endl;
+  assert (propagator.backtracks > 1);
+  assert (propagator.late > 0);
+  assert (propagator.asked > 0);
+  return 0;
+}
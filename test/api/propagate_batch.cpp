@@ -0,0 +1,140 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <vector>
+using namespace std;
+
+// The variables are split into 'blocks' of 'width' variables which have to
+// be equal, which is only propagated externally: as soon as one variable of
+// a block is assigned all the others get its value in the same batch.  The
+// clauses connect different variables of neighbouring blocks and forbid
+// the last block to be true, which lets unit propagation falsify literals
+// before the propagator sees them, thus batches also contain falsified
+// literals.  Models over the first variable of each block are enumerated
+// with blocking clauses and compared to brute force enumeration.
+
+const int blocks = 6, width = 4, n = blocks * width;
+
+static int var (int b, int i) { return b * width + i + 1; }
+static int block (int lit) { return (abs (lit) - 1) / width; }
+
+class Equalities : public CaDiCaL::ExternalPropagator {
+  CaDiCaL::Solver *solver;
+  CaDiCaL::TrailMirror mirror;
+  vector<int> triggers, reasons, batch, reason, clause;
+
+public:
+  int models = 0, batches = 0, falsified = 0;
+
+  Equalities (CaDiCaL::Solver *s) : solver (s) {
+    reasons.resize (n + 1);
+    solver->connect_external_propagator (this);
+    for (int idx = 1; idx <= n; idx++)
+      solver->add_observed_var (idx);
+  }
+  ~Equalities () { solver->disconnect_external_propagator (); }
+
+  void notify_assignment (const vector<int> &lits) override {
+    mirror.assign (lits);
+  }
+  void notify_new_decision_level () override { mirror.new_level (); }
+  void notify_backtrack (size_t new_level) override {
+    mirror.backtrack (new_level);
+  }
+
+  // The first assigned variable of a block on the trail determines the
+  // value of all the others in that block.
+
+  bool cb_propagate_batch (const int *&lits, size_t &size) override {
+    triggers.assign (blocks, 0);
+    for (auto lit : mirror)
+      if (!triggers[block (lit)])
+        triggers[block (lit)] = lit;
+    batch.clear ();
+    for (int b = 0; b < blocks; b++) {
+      const int trigger = triggers[b];
+      if (!trigger)
+        continue;
+      for (int i = 0; i < width; i++) {
+        const int lit = trigger < 0 ? -var (b, i) : var (b, i);
+        const int tmp = mirror.value (lit);
+        if (tmp > 0)
+          continue;
+        if (tmp < 0)
+          falsified++;
+        reasons[abs (lit)] = trigger;
+        batch.push_back (lit);
+      }
+    }
+    if (batch.size () > 1)
+      batches++;
+    lits = batch.data ();
+    size = batch.size ();
+    return true;
+  }
+  int cb_propagate () override {
+    assert (false);
+    return 0;
+  }
+  bool cb_add_reason_clause (int propagated, const int *&lits,
+                             size_t &size) override {
+    const int trigger = reasons[abs (propagated)];
+    assert (block (trigger) == block (propagated));
+    assert (mirror.value (trigger) > 0);
+    reason = {propagated, -trigger};
+    lits = reason.data ();
+    size = reason.size ();
+    return true;
+  }
+
+  bool cb_check_found_model (const vector<int> &) override { return true; }
+  bool cb_has_external_clause (bool &forgettable) override {
+    forgettable = false;
+    if (mirror.size () < (size_t) n)
+      return false;
+    for (int idx = 1; idx <= n; idx++)
+      if (mirror.value (idx) != mirror.value (var (block (idx), 0)))
+        return false;
+    models++;
+    clause.clear ();
+    for (int b = 0; b < blocks; b++)
+      clause.push_back (-mirror.value (var (b, 0)) * var (b, 0));
+    return true;
+  }
+  bool cb_add_external_clause (const int *&lits, size_t &size) override {
+    lits = clause.data ();
+    size = clause.size ();
+    return true;
+  }
+  int cb_add_external_clause_lit () override {
+    assert (false);
+    return 0;
+  }
+};
+
+int main () {
+  CaDiCaL::Solver solver;
+  for (int b = 0; b + 1 < blocks; b++)
+    solver.clause (var (b, 1), var (b + 1, 2));
+  solver.clause (-var (blocks - 1, 1), -var (blocks - 1, 3));
+  int expected = 0;
+  for (unsigned values = 0; values < 1u << blocks; values++) {
+    bool satisfied = !(values >> (blocks - 1) & 1);
+    for (int b = 0; satisfied && b + 1 < blocks; b++)
+      satisfied = (values >> b & 3);
+    expected += satisfied;
+  }
+  Equalities propagator (&solver);
+  int res = solver.solve ();
+  assert (res == 20);
+  cout << propagator.models << " models (expected " << expected
+       << ") with " << propagator.batches << " propagated batches and "
+       << propagator.falsified << " falsified literals" << endl;
+  assert (propagator.models == expected);
+  assert (propagator.batches > 0);
+  assert (propagator.falsified > 0);
+  return 0;
+}
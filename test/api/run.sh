@@ -117,6 +117,10 @@ run traverse
 run cipasir
 run incproof
 run propagate_assumptions
+run trailview
+run propagate_batch
+run threshold
+run priorities
 
 if [ "`grep DNTRACING $makefile`" = "" ]
 then
@@ -0,0 +1,114 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <vector>
+using namespace std;
+
+// The first 'n' variables form an implication chain, thus a single true
+// decision assigns all the following variables at once.  The propagator
+// observes them with an 'observed_threshold' of 't' below 'n' and should
+// only be notified and called back once 't' of them are assigned, which
+// is usually crossed in the middle of a propagation.  The 'n + 1' models
+// (a false prefix followed by a true suffix) are enumerated with blocking
+// clauses on complete assignments.
+
+const int n = 12, t = 8;
+
+class Sleeper : public CaDiCaL::TrailViewPropagator {
+  CaDiCaL::Solver *solver;
+  const CaDiCaL::ExternalTrail *trail = 0;
+  vector<int> values, handed;
+
+  void awake () const {
+    assert (trail);
+    assert (trail->size >= (size_t) t);
+  }
+
+public:
+  int models = 0, wakeups = 0, crossings = 0;
+
+  Sleeper (CaDiCaL::Solver *s) : solver (s) {
+    observed_threshold = t;
+    values.resize (n + 1);
+    solver->connect_external_propagator (this);
+    for (int idx = 1; idx <= n; idx++)
+      solver->add_observed_var (idx);
+  }
+  ~Sleeper () { solver->disconnect_external_propagator (); }
+
+  void notify_trail (const CaDiCaL::ExternalTrail &view,
+                     size_t from) override {
+    trail = &view;
+    awake ();
+    assert (from < view.size);
+    if (from < (size_t) t) {
+      wakeups++;
+      if (view.size > (size_t) t)
+        crossings++;
+    }
+    for (size_t i = from; i < view.size; i++) {
+      const int lit = view.lits[i];
+      assert (!values[abs (lit)]);
+      values[abs (lit)] = lit;
+    }
+  }
+  void notify_backtrack (size_t new_level) override {
+    assert (trail);
+    assert (new_level < trail->level);
+    assert (trail->levels[new_level] < trail->size);
+    for (size_t i = trail->levels[new_level]; i < trail->size; i++) {
+      const int lit = trail->lits[i];
+      assert (values[abs (lit)] == lit);
+      values[abs (lit)] = 0;
+    }
+  }
+  int cb_propagate () override {
+    awake ();
+    return 0;
+  }
+  int cb_decide () override {
+    awake ();
+    return 0;
+  }
+  bool cb_check_found_model (const vector<int> &) override { return true; }
+  bool cb_has_external_clause (bool &forgettable) override {
+    awake ();
+    forgettable = false;
+    if (trail->size < (size_t) n)
+      return false;
+    models++;
+    handed.clear ();
+    for (int idx = 1; idx <= n; idx++) {
+      assert (idx == 1 || values[idx - 1] < 0 || values[idx] > 0);
+      handed.push_back (-values[idx]);
+    }
+    return true;
+  }
+  bool cb_add_external_clause (const int *&lits, size_t &size) override {
+    lits = handed.data ();
+    size = handed.size ();
+    return true;
+  }
+  int cb_add_external_clause_lit () override {
+    assert (false);
+    return 0;
+  }
+};
+
+int main () {
+  CaDiCaL::Solver solver;
+  for (int idx = 1; idx < n; idx++)
+    solver.clause (-idx, idx + 1);
+  Sleeper sleeper (&solver);
+  int res = solver.solve ();
+  assert (res == 20);
+  cout << sleeper.models << " models with " << sleeper.wakeups
+       << " wake ups of which " << sleeper.crossings
+       << " crossed the threshold of " << t << " mid-propagation" << endl;
+  assert (sleeper.models == n + 1);
+  assert (sleeper.crossings > 0);
+  return 0;
+}
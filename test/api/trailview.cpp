@@ -0,0 +1,149 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+// Solves the same unsatisfiable pigeon hole formula twice with all
+// variables observed, once with a propagator using the classic notification
+// interface (mirrored with 'TrailMirror') and once with one using the trail
+// view.  Neither propagates anything, thus the search is the same and the
+// assignment seen at every 'cb_propagate' (its decision level, size and a
+// hash of its literals) has to be the same too, across all backtracking.
+
+const int holes = 5, pigeons = holes + 1;
+
+static int var (int p, int h) { return p * holes + h + 1; }
+
+struct Snapshot {
+  size_t level, size;
+  uint64_t hash;
+  bool operator== (const Snapshot &other) const {
+    return level == other.level && size == other.size &&
+           hash == other.hash;
+  }
+};
+
+static uint64_t hash_lit (int lit) {
+  return (uint64_t) (2 * abs (lit) + (lit < 0)) * 1111111111111111111ull;
+}
+
+// What both propagators record, as they never propagate or add clauses.
+
+struct Recorder {
+  vector<Snapshot> snapshots;
+  size_t backtracks = 0;
+};
+
+class Classic : public CaDiCaL::ExternalPropagator {
+  CaDiCaL::TrailMirror mirror;
+
+public:
+  Recorder recorder;
+
+  void notify_assignment (const vector<int> &lits) override {
+    mirror.assign (lits);
+  }
+  void notify_new_decision_level () override { mirror.new_level (); }
+  void notify_backtrack (size_t new_level) override {
+    recorder.backtracks++;
+    mirror.backtrack (new_level);
+  }
+  int cb_propagate () override {
+    uint64_t hash = 0;
+    for (auto lit : mirror)
+      hash += hash_lit (lit);
+    recorder.snapshots.push_back ({mirror.level (), mirror.size (), hash});
+    return 0;
+  }
+  bool cb_check_found_model (const vector<int> &) override { return true; }
+  bool cb_has_external_clause (bool &) override { return false; }
+  int cb_add_external_clause_lit () override { return 0; }
+};
+
+class View : public CaDiCaL::TrailViewPropagator {
+  const CaDiCaL::ExternalTrail *trail = 0;
+  vector<char> assigned;
+  uint64_t hash = 0;
+
+public:
+  Recorder recorder;
+
+  View () { assigned.resize (holes * pigeons + 1); }
+
+  void notify_trail (const CaDiCaL::ExternalTrail &view,
+                     size_t from) override {
+    trail = &view;
+    assert (from < view.size);
+    for (size_t l = 1; l < view.level; l++)
+      assert (view.levels[l - 1] <= view.levels[l]);
+    for (size_t i = from; i < view.size; i++) {
+      const int lit = view.lits[i];
+      assert (!assigned[abs (lit)]);
+      assigned[abs (lit)] = true;
+      hash += hash_lit (lit);
+    }
+  }
+  void notify_backtrack (size_t new_level) override {
+    assert (trail);
+    recorder.backtracks++;
+    if (new_level >= trail->level)
+      return;
+    for (size_t i = trail->levels[new_level]; i < trail->size; i++) {
+      const int lit = trail->lits[i];
+      assert (assigned[abs (lit)]);
+      assigned[abs (lit)] = false;
+      hash -= hash_lit (lit);
+    }
+  }
+  int cb_propagate () override {
+    if (trail)
+      recorder.snapshots.push_back ({trail->level, trail->size, hash});
+    else
+      recorder.snapshots.push_back ({0, 0, 0});
+    return 0;
+  }
+  bool cb_check_found_model (const vector<int> &) override { return true; }
+  bool cb_has_external_clause (bool &) override { return false; }
+  int cb_add_external_clause_lit () override { return 0; }
+};
+
+static void solve (CaDiCaL::ExternalPropagator *propagator) {
+  CaDiCaL::Solver solver;
+  for (int p = 0; p < pigeons; p++) {
+    for (int h = 0; h < holes; h++)
+      solver.add (var (p, h));
+    solver.add (0);
+  }
+  for (int h = 0; h < holes; h++)
+    for (int p = 0; p < pigeons; p++)
+      for (int q = p + 1; q < pigeons; q++)
+        solver.clause (-var (p, h), -var (q, h));
+  solver.connect_external_propagator (propagator);
+  for (int idx = 1; idx <= holes * pigeons; idx++)
+    solver.add_observed_var (idx);
+  int res = solver.solve ();
+  assert (res == 20);
+  solver.disconnect_external_propagator ();
+}
+
+int main () {
+  Classic classic;
+  solve (&classic);
+  View view;
+  solve (&view);
+  cout << "classic notification: " << classic.recorder.snapshots.size ()
+       << " propagations " << classic.recorder.backtracks << " backtracks"
+       << endl;
+  cout << "trail view notification: " << view.recorder.snapshots.size ()
+       << " propagations " << view.recorder.backtracks << " backtracks"
+       << endl;
+  assert (classic.recorder.backtracks > 0);
+  assert (classic.recorder.snapshots.size () > 1);
+  assert (classic.recorder.snapshots == view.recorder.snapshots);
+  return 0;
+}
@@ -62,7 +62,8 @@ public:
         return false;
     }
 
-    bool cb_has_external_clause () {
+    bool cb_has_external_clause (bool & is_forgettable) {
+        is_forgettable = false;
         return (!blocking_clause.empty());
     }
 
@@ -77,7 +78,7 @@ public:
 
 
 
-    void notify_assignment (int,bool) {};
+    void notify_assignment (const std::vector<int> &) {};
     void notify_new_decision_level () {};
     void notify_backtrack (size_t) {};
     int cb_decide () { return 0; }
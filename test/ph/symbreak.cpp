@@ -20,19 +20,14 @@ static int hole_id (int lit) {
     return (int)floor((idx - 1)/(n + 1));
 }
 
-static bool has_lit(const std::deque<std::vector<int>> & current_trail, int lit) {
-    for (auto level_lits : current_trail) {
-        if(std::find(level_lits.begin(), level_lits.end(), lit) != level_lits.end()) {
-            return true;
-        }
-    }
-    return false;
+static bool has_lit(const CaDiCaL::TrailMirror & current_trail, int lit) {
+    return current_trail.value(lit) > 0;
 }
 
 class SymmetryBreaker : CaDiCaL::ExternalPropagator {
     CaDiCaL::Solver * solver;
     std::vector<std::vector<int>> new_clauses;
-    std::deque<std::vector<int>> current_trail;
+    CaDiCaL::TrailMirror current_trail;
 public:
     SymmetryBreaker(CaDiCaL::Solver * s, int order) : solver(s) {
         if (order == 0) {
@@ -45,22 +40,21 @@ public:
         for (int h = 0; h < n; h++)
             for (int p = 0; p < n + 1; p++)
             solver->add_observed_var(ph(p,h));
-
-        // The root-level of the trail is always there
-        current_trail.push_back(std::vector<int>());
     }
 
     ~SymmetryBreaker () {
         solver->disconnect_external_propagator ();
     }
 
-    void notify_assignment(int lit, bool is_fixed) {
-        if (is_fixed) {
-            current_trail.front().push_back(lit);
-        } else {
-            current_trail.back().push_back(lit);
+    void notify_assignment(const std::vector<int> & lits) {
+        for (int lit : lits) {
+            if (current_trail.value(lit)) continue;
+            current_trail.assign(lit);
+            check_assignment(lit);
         }
+    }
 
+    void check_assignment(int lit) {
         int p = pigeon_id(lit);
         int h = hole_id(lit);
         int j = p + 1;
@@ -115,13 +109,11 @@ public:
     }
 
     void notify_new_decision_level () {
-        current_trail.push_back(std::vector<int>());
+        current_trail.new_level();
     }
 
     void notify_backtrack (size_t new_level) {
-        while (current_trail.size() > new_level + 1) {
-            current_trail.pop_back();
-        }
+        current_trail.backtrack(new_level);
     }
 
     bool cb_check_found_model (const std::vector<int> & model) { 
@@ -129,7 +121,8 @@ public:
         return true;
     }
 
-    bool cb_has_external_clause () {
+    bool cb_has_external_clause (bool & is_forgettable) {
+        is_forgettable = false;
 #ifdef VERBOSE
         if (!new_clauses.empty()) {
             std::cout << "c New blocking clause: ";